@@ -0,0 +1,133 @@
+/**
+ * @brief mw-bench-batch-math: engine/utils/batch_math 与 glm 标量循环的性能对比
+ *
+ * 同一份源码编译为三个可执行文件（Scalar / SSE2 / AVX2 实现），每个都会先跑 glm 的 AoS 标量循环作为基准：
+ * - integrate：position += velocity * dt（另外测量 MovementSystem 若先收集为SoA再写回的总耗时）
+ * - arc：抛物线弧形轨迹（mix + sin，与 ProjectileSystem 相同）
+ * - radius：半径检测，输出所有命中的索引（与 SetTargetSystem 治疗者的检测相同）
+ *
+ * 用法: mw-bench-batch-math-<backend> [iterations]
+ */
+#include "bench_utils.h"
+#include "../src/engine/utils/batch_math.h"
+#include <glm/common.hpp>
+#include <glm/trigonometric.hpp>
+#include <glm/gtc/constants.hpp>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+namespace
+{
+    /// @brief 测试数据：同一组随机数同时保存为 AoS (glm::vec2) 与 SoA 两种布局
+    struct Data
+    {
+        std::vector<glm::vec2> pos, vel, start, target;
+        std::vector<float> t, arc;
+        engine::utils::Vec2SoA pos_soa, vel_soa, start_soa, target_soa, out_soa;
+        std::vector<uint32_t> hits;
+
+        explicit Data(size_t count)
+        {
+            std::mt19937 rng(42);
+            std::uniform_real_distribution<float> coord(0.0f, 1000.0f);
+            std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+            for (size_t i = 0; i < count; ++i)
+            {
+                pos.emplace_back(coord(rng), coord(rng));
+                vel.emplace_back(unit(rng) * 100.0f, unit(rng) * 100.0f);
+                start.emplace_back(coord(rng), coord(rng));
+                target.emplace_back(coord(rng), coord(rng));
+                t.push_back(unit(rng));
+                arc.push_back(unit(rng) * 50.0f);
+                pos_soa.push(pos.back());
+                vel_soa.push(vel.back());
+                start_soa.push(start.back());
+                target_soa.push(target.back());
+                out_soa.push({});
+            }
+            hits.resize(count);
+        }
+    };
+
+    void runCount(size_t count, int iterations)
+    {
+        Data data(count);
+        constexpr float dt = 1.0f / 60.0f;
+        const glm::vec2 center{500.0f, 500.0f};
+        const float radius_sq = 150.0f * 150.0f;
+
+        // --- integrate ---
+        bench::report("integrate: glm AoS", count, bench::measureUs([&]
+                                                                     {
+            for (size_t i = 0; i < count; ++i)
+                data.pos[i] += data.vel[i] * dt;
+            bench::consume(data.pos[count / 2].x); }, iterations));
+        bench::report("integrate: batch SoA", count, bench::measureUs([&]
+                                                                       {
+            engine::utils::integrateBatch(data.pos_soa.x.data(), data.pos_soa.y.data(),
+                                          data.vel_soa.x.data(), data.vel_soa.y.data(), count, dt);
+            bench::consume(data.pos_soa.x[count / 2]); }, iterations));
+        bench::report("integrate: AoS -> SoA -> batch -> AoS", count, bench::measureUs([&]
+                                                                                         {
+            data.pos_soa.clear();
+            data.vel_soa.clear();
+            for (size_t i = 0; i < count; ++i)
+            {
+                data.pos_soa.push(data.pos[i]);
+                data.vel_soa.push(data.vel[i]);
+            }
+            engine::utils::integrateBatch(data.pos_soa.x.data(), data.pos_soa.y.data(),
+                                          data.vel_soa.x.data(), data.vel_soa.y.data(), count, dt);
+            for (size_t i = 0; i < count; ++i)
+                data.pos[i] = data.pos_soa.get(i);
+            bench::consume(data.pos[count / 2].x); }, iterations));
+
+        // --- arc ---
+        bench::report("arc: glm AoS", count, bench::measureUs([&]
+                                                               {
+            for (size_t i = 0; i < count; ++i)
+            {
+                float p = glm::clamp(data.t[i], 0.0f, 1.0f);
+                data.pos[i] = glm::mix(data.start[i], data.target[i], p);
+                data.pos[i].y -= glm::sin(p * glm::pi<float>()) * data.arc[i];
+            }
+            bench::consume(data.pos[count / 2].y); }, iterations));
+        bench::report("arc: batch SoA", count, bench::measureUs([&]
+                                                                 {
+            engine::utils::lerpArcBatch(data.start_soa.x.data(), data.start_soa.y.data(),
+                                        data.target_soa.x.data(), data.target_soa.y.data(),
+                                        data.t.data(), data.arc.data(),
+                                        data.out_soa.x.data(), data.out_soa.y.data(), count);
+            bench::consume(data.out_soa.y[count / 2]); }, iterations));
+
+        // --- radius ---
+        bench::report("radius: glm AoS", count, bench::measureUs([&]
+                                                                  {
+            size_t hit_count = 0;
+            for (size_t i = 0; i < count; ++i)
+            {
+                glm::vec2 d = data.start[i] - center;
+                if (d.x * d.x + d.y * d.y < radius_sq)
+                    data.hits[hit_count++] = static_cast<uint32_t>(i);
+            }
+            bench::consume(hit_count); }, iterations));
+        bench::report("radius: batch SoA", count, bench::measureUs([&]
+                                                                    {
+            auto hit_count = engine::utils::radiusTestMany(center, radius_sq, data.start_soa.x.data(), data.start_soa.y.data(),
+                                                           count, data.hits.data(), false);
+            bench::consume(hit_count); }, iterations));
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    const int iterations = argc > 1 ? std::atoi(argv[1]) : 1000;
+    std::printf("batch math backend: %s\n", engine::utils::batchMathBackend());
+    std::printf("%-40s %8s %15s\n", "case", "count", "time/iter");
+    for (size_t count : {1000u, 10000u, 50000u})
+    {
+        runCount(count, iterations);
+    }
+    return 0;
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include <chrono>
+#include <cstdio>
+
+namespace bench
+{
+    /**
+     * @brief 多次运行函数并返回平均每次的耗时（微秒），先预热几次
+     * @param func 被测函数
+     * @param iterations 计时的运行次数
+     */
+    template <typename Func>
+    double measureUs(Func &&func, int iterations)
+    {
+        for (int i = 0; i < 3; ++i)
+        {
+            func();
+        }
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i)
+        {
+            func();
+        }
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        return std::chrono::duration<double, std::micro>(elapsed).count() / iterations;
+    }
+
+    /// @brief 输出一行结果：名称、规模、平均耗时
+    inline void report(const char *name, size_t count, double us)
+    {
+        std::printf("%-40s %8zu %12.2f us\n", name, count, us);
+    }
+
+    inline volatile double g_sink = 0.0; ///< @brief 计算结果写入此处，防止被编译器优化掉
+
+    /// @brief 写入 volatile 变量，防止编译器把计算结果优化掉
+    template <typename T>
+    void consume(T value)
+    {
+        g_sink = static_cast<double>(value);
+    }
+}
@@ -0,0 +1,116 @@
+/**
+ * @brief mw-bench-ecs: view 与 group 的遍历性能对比（1k / 10k / 50k 实体）
+ *
+ * 场景与游戏中的移动相关系统一致：所有移动实体都有速度 + 变换，其中大部分是敌人，
+ * 一部分被阻挡 (BlockedBy) 或锁定动作 (ActionLock)；另有一批只有变换的静态实体。
+ * - 移动：view<Velocity, Transform> 与 owning group 对比
+ * - 筛选后的敌人（寻路）：view + exclude、owning group + 逐实体检查、non-owning group 三种方式对比
+ *
+ * 用法: mw-bench-ecs [iterations]
+ */
+#include "bench_utils.h"
+#include "../src/game/system/movement_groups.h"
+#include <cstdlib>
+#include <random>
+
+namespace
+{
+    using engine::component::TransformComponent;
+    using engine::component::VelocityComponent;
+    using game::component::BlockedByComponent;
+    using game::component::EnemyComponent;
+    using game::defs::ActionLockTag;
+
+    /// @brief 创建测试实体：count 个移动实体（80% 敌人，其中 10% 被阻挡、5% 锁定动作），以及 count/2 个静态实体
+    void populate(entt::registry &registry, size_t count)
+    {
+        std::mt19937 rng(42);
+        std::uniform_real_distribution<float> pos(0.0f, 1000.0f);
+        std::uniform_real_distribution<float> chance(0.0f, 1.0f);
+        for (size_t i = 0; i < count; ++i)
+        {
+            auto entity = registry.create();
+            registry.emplace<TransformComponent>(entity, glm::vec2(pos(rng), pos(rng)));
+            registry.emplace<VelocityComponent>(entity, glm::vec2(1.0f, 0.5f));
+            if (chance(rng) < 0.8f)
+            {
+                registry.emplace<EnemyComponent>(entity, 0, 50.0f);
+                const float roll = chance(rng);
+                if (roll < 0.10f)
+                    registry.emplace<BlockedByComponent>(entity, entity);
+                else if (roll < 0.15f)
+                    registry.emplace<ActionLockTag>(entity);
+            }
+            // 静态实体（只有变换，例如地图装饰、玩家单位），让 view 需要在更大的集合上求交
+            if (i % 2 == 0)
+            {
+                registry.emplace<TransformComponent>(registry.create(), glm::vec2(pos(rng), pos(rng)));
+            }
+        }
+    }
+
+    /// @brief 与寻路系统相同的计算量：朝固定目标点更新速度
+    inline float steer(VelocityComponent &velocity, const TransformComponent &transform, const EnemyComponent &enemy)
+    {
+        velocity.velocity_ = (glm::vec2(500.0f, 500.0f) - transform.position_) * (enemy.speed_ * 0.001f);
+        return velocity.velocity_.x;
+    }
+
+    void runCount(size_t count, int iterations)
+    {
+        entt::registry registry;
+        game::system::declareMovementGroups(registry);
+        populate(registry, count);
+        constexpr float dt = 1.0f / 60.0f;
+
+        // --- 移动：position += velocity * dt ---
+        bench::report("move: view<Velocity, Transform>", count, bench::measureUs([&]
+                                                                                  {
+            auto view = registry.view<VelocityComponent, TransformComponent>();
+            for (auto [entity, velocity, transform] : view.each())
+                transform.position_ += velocity.velocity_ * dt; }, iterations));
+        bench::report("move: owning group", count, bench::measureUs([&]
+                                                                     {
+            for (auto [entity, velocity, transform] : engine::system::MovementSystem::group(registry).each())
+                transform.position_ += velocity.velocity_ * dt; }, iterations));
+
+        // --- 筛选后的敌人：未被阻挡、未锁定动作 ---
+        bench::report("enemies: view + exclude", count, bench::measureUs([&]
+                                                                          {
+            float sum = 0.0f;
+            auto view = registry.view<VelocityComponent, TransformComponent, EnemyComponent>(entt::exclude<BlockedByComponent, ActionLockTag>);
+            for (auto [entity, velocity, transform, enemy] : view.each())
+                sum += steer(velocity, transform, enemy);
+            bench::consume(sum); }, iterations));
+        bench::report("enemies: owning group + per-entity checks", count, bench::measureUs([&]
+                                                                                            {
+            float sum = 0.0f;
+            for (auto [entity, velocity, transform] : engine::system::MovementSystem::group(registry).each())
+            {
+                if (registry.any_of<BlockedByComponent, ActionLockTag>(entity))
+                    continue;
+                auto *enemy = registry.try_get<EnemyComponent>(entity);
+                if (!enemy)
+                    continue;
+                sum += steer(velocity, transform, *enemy);
+            }
+            bench::consume(sum); }, iterations));
+        bench::report("enemies: non-owning group", count, bench::measureUs([&]
+                                                                            {
+            float sum = 0.0f;
+            for (auto [entity, velocity, transform, enemy] : game::system::walkingEnemyGroup(registry).each())
+                sum += steer(velocity, transform, enemy);
+            bench::consume(sum); }, iterations));
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    const int iterations = argc > 1 ? std::atoi(argv[1]) : 200;
+    std::printf("%-40s %8s %15s\n", "case", "entities", "time/iter");
+    for (size_t count : {1000u, 10000u, 50000u})
+    {
+        runCount(count, iterations);
+    }
+    return 0;
+}
@@ -4,8 +4,11 @@
 #include <spdlog/spdlog.h>
 #include <glm/glm.hpp>
 #include <entt/core/hashed_string.hpp>
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <fstream>
 
-engine::audio::AudioPlayer::AudioPlayer(engine::resource::ResourceManager *resource_manager)
+engine::audio::AudioPlayer::AudioPlayer(engine::resource::ResourceManager *resource_manager, size_t voice_count)
     : resource_manager_(resource_manager)
 {
     if (!resource_manager_)
@@ -17,6 +20,27 @@ engine::audio::AudioPlayer::AudioPlayer(engine::resource::ResourceManager *resou
     {
         throw std::runtime_error("MIX_Mixer is nullptr");
     }
+
+    // 预先创建所有音效声部，播放时不再创建音轨
+    voices_.reserve(voice_count);
+    for (size_t i = 0; i < voice_count; ++i)
+    {
+        MIX_Track *track = MIX_CreateTrack(mixer_);
+        if (!track)
+        {
+            spdlog::error("Failed to create sound track {}: {}", i, SDL_GetError());
+            break;
+        }
+        voices_.push_back(Voice{track});
+    }
+    if (voices_.empty())
+    {
+        throw std::runtime_error("Failed to create any sound track");
+    }
+
+    // 音效播放参数固定（不循环），创建一次后复用
+    sound_props_ = SDL_CreateProperties();
+    SDL_SetNumberProperty(sound_props_, MIX_PROP_PLAY_LOOPS_NUMBER, 0);
 }
 
 engine::audio::AudioPlayer::~AudioPlayer()
@@ -27,15 +51,20 @@ engine::audio::AudioPlayer::~AudioPlayer()
         MIX_DestroyTrack(musicTrack_);
         musicTrack_ = nullptr;
     }
-    if (soundTrack_)
+    for (auto &voice : voices_)
+    {
+        MIX_StopTrack(voice.track_, 0);
+        MIX_DestroyTrack(voice.track_);
+    }
+    voices_.clear();
+    if (sound_props_)
     {
-        MIX_StopTrack(soundTrack_, 0);
-        MIX_DestroyTrack(soundTrack_);
-        soundTrack_ = nullptr;
+        SDL_DestroyProperties(sound_props_);
+        sound_props_ = 0;
     }
 }
 
-int engine::audio::AudioPlayer::playSound(entt::id_type sound_id, int channel)
+int engine::audio::AudioPlayer::playSound(entt::id_type sound_id, int channel, float gain, float pan)
 {
     MIX_Audio *audio = resource_manager_->getSound(sound_id);
     if (!audio)
@@ -43,74 +72,163 @@ int engine::audio::AudioPlayer::playSound(entt::id_type sound_id, int channel)
         spdlog::error("Sound not found for id: {}", sound_id);
         return -1;
     }
+    return playSoundAudio(audio, sound_id, channel, gain, pan);
+}
 
-    if (!soundTrack_)
+int engine::audio::AudioPlayer::playSound(entt::hashed_string hashed_path, int channel, float gain, float pan)
+{
+    MIX_Audio *audio = resource_manager_->getSound(hashed_path);
+    if (!audio)
     {
-        soundTrack_ = MIX_CreateTrack(mixer_);
-        if (!soundTrack_)
-        {
-            spdlog::error("Failed to create sound track: {}", SDL_GetError());
-            return -1;
-        }
+        spdlog::error("Sound not found: {}", hashed_path.data());
+        return -1;
     }
+    return playSoundAudio(audio, hashed_path.value(), channel, gain, pan);
+}
 
-    if (!MIX_SetTrackAudio(soundTrack_, audio))
+bool engine::audio::AudioPlayer::loadSoundSettings(const std::string &file_path)
+{
+    std::ifstream file(file_path);
+    if (!file.is_open())
     {
-        spdlog::error("Failed to set track audio: {}", SDL_GetError());
-        return -1;
+        spdlog::warn("Sound settings file not found: {}, using defaults", file_path);
+        return false;
     }
-
-    SDL_PropertiesID props = SDL_CreateProperties();
-    SDL_SetNumberProperty(props, MIX_PROP_PLAY_LOOPS_NUMBER, 0);
-
-    if (!MIX_PlayTrack(soundTrack_, props))
+    try
     {
-        spdlog::error("Failed to play sound track: {}", SDL_GetError());
-        SDL_DestroyProperties(props);
-        return -1;
+        nlohmann::json json;
+        file >> json;
+        for (const auto &[key, value] : json.items())
+        {
+            SoundSettings settings;
+            settings.priority_ = value.value("priority", settings.priority_);
+            settings.max_instances_ = std::max(1, value.value("max_instances", settings.max_instances_));
+            settings.gain_ = std::max(0.0f, value.value("gain", settings.gain_));
+            sound_settings_[entt::hashed_string(key.c_str())] = settings;
+        }
     }
+    catch (const std::exception &e)
+    {
+        spdlog::error("Failed to parse sound settings {}: {}", file_path, e.what());
+        return false;
+    }
+    spdlog::info("Loaded {} sound settings from {}", sound_settings_.size(), file_path);
+    return true;
+}
 
-    SDL_DestroyProperties(props);
-    return 0;
+const engine::audio::SoundSettings &engine::audio::AudioPlayer::getSoundSettings(entt::id_type sound_id) const
+{
+    static const SoundSettings DEFAULT_SETTINGS{};
+    auto it = sound_settings_.find(sound_id);
+    return it != sound_settings_.end() ? it->second : DEFAULT_SETTINGS;
 }
 
-int engine::audio::AudioPlayer::playSound(entt::hashed_string hashed_path, int channel)
+int engine::audio::AudioPlayer::playSoundAudio(MIX_Audio *audio, entt::id_type sound_id, int channel, float gain, float pan)
 {
-    MIX_Audio *audio = resource_manager_->getSound(hashed_path);
-    if (!audio)
+    const auto &settings = getSoundSettings(sound_id);
+    int index = (channel >= 0 && channel < static_cast<int>(voices_.size())) ? channel : selectVoice(settings, sound_id);
+    if (index < 0)
     {
-        spdlog::error("Sound not found: {}", hashed_path.data());
+        ++voice_stats_.dropped_;
         return -1;
     }
 
-    if (!soundTrack_)
+    auto &voice = voices_[index];
+    if (MIX_TrackPlaying(voice.track_))
     {
-        soundTrack_ = MIX_CreateTrack(mixer_);
-        if (!soundTrack_)
-        {
-            spdlog::error("Failed to create sound track: {}", SDL_GetError());
-            return -1;
-        }
+        ++voice_stats_.stolen_;
+        MIX_StopTrack(voice.track_, 0);
     }
-
-    if (!MIX_SetTrackAudio(soundTrack_, audio))
+    if (!MIX_SetTrackAudio(voice.track_, audio))
     {
         spdlog::error("Failed to set track audio: {}", SDL_GetError());
         return -1;
     }
 
-    SDL_PropertiesID props = SDL_CreateProperties();
-    SDL_SetNumberProperty(props, MIX_PROP_PLAY_LOOPS_NUMBER, 0);
+    voice.sound_id_ = sound_id;
+    voice.priority_ = settings.priority_;
+    voice.gain_ = settings.gain_ * gain;
+    voice.serial_ = ++play_serial_;
+    MIX_SetTrackGain(voice.track_, sound_volume_ * voice.gain_);
+    if (pan != 0.0f)
+    {
+        // 线性声像：偏向一侧时只衰减另一侧声道
+        pan = std::clamp(pan, -1.0f, 1.0f);
+        MIX_StereoGains gains{std::min(1.0f, 1.0f - pan), std::min(1.0f, 1.0f + pan)};
+        MIX_SetTrackStereo(voice.track_, &gains);
+    }
+    else
+    {
+        MIX_SetTrackStereo(voice.track_, nullptr); // 恢复为不做声像处理
+    }
 
-    if (!MIX_PlayTrack(soundTrack_, props))
+    if (!MIX_PlayTrack(voice.track_, sound_props_))
     {
         spdlog::error("Failed to play sound track: {}", SDL_GetError());
-        SDL_DestroyProperties(props);
         return -1;
     }
+    ++voice_stats_.played_;
+    return index;
+}
 
-    SDL_DestroyProperties(props);
-    return 0;
+int engine::audio::AudioPlayer::selectVoice(const SoundSettings &settings, entt::id_type sound_id)
+{
+    int free_index = -1;
+    int oldest_same = -1;
+    int same_count = 0;
+    int victim = -1;
+    for (int i = 0; i < static_cast<int>(voices_.size()); ++i)
+    {
+        const auto &voice = voices_[i];
+        if (!MIX_TrackPlaying(voice.track_))
+        {
+            if (free_index < 0)
+                free_index = i;
+            continue;
+        }
+        if (voice.sound_id_ == sound_id)
+        {
+            ++same_count;
+            if (oldest_same < 0 || voice.serial_ < voices_[oldest_same].serial_)
+                oldest_same = i;
+        }
+        // 抢占候选：优先级不高于新音效，依次比较 优先级低 -> 更安静 -> 更早开始
+        if (voice.priority_ > settings.priority_)
+            continue;
+        if (victim < 0)
+        {
+            victim = i;
+            continue;
+        }
+        const auto &best = voices_[victim];
+        if (voice.priority_ != best.priority_)
+        {
+            if (voice.priority_ < best.priority_)
+                victim = i;
+        }
+        else if (voice.gain_ != best.gain_)
+        {
+            if (voice.gain_ < best.gain_)
+                victim = i;
+        }
+        else if (voice.serial_ < best.serial_)
+        {
+            victim = i;
+        }
+    }
+
+    // 同名音效达到上限时替换最早的一个（不占用其他声部）
+    if (same_count >= settings.max_instances_)
+        return oldest_same;
+    if (free_index >= 0)
+        return free_index;
+    return victim;
+}
+
+size_t engine::audio::AudioPlayer::getActiveVoiceCount() const
+{
+    return static_cast<size_t>(std::count_if(voices_.begin(), voices_.end(), [](const Voice &voice)
+                                              { return MIX_TrackPlaying(voice.track_); }));
 }
 
 int engine::audio::AudioPlayer::playMusic(entt::id_type music_id, int loops, int fade_in_ms)
@@ -229,9 +347,18 @@ void engine::audio::AudioPlayer::resumeMusic()
 
 void engine::audio::AudioPlayer::setSoundVolume(float volume, int channel)
 {
-    if (soundTrack_)
+    if (channel >= 0 && channel < static_cast<int>(voices_.size()))
+    {
+        MIX_SetTrackGain(voices_[channel].track_, volume);
+        return;
+    }
+    // 全局音效音量：更新所有声部（包括正在播放的）
+    if (volume == sound_volume_)
+        return;
+    sound_volume_ = volume;
+    for (const auto &voice : voices_)
     {
-        MIX_SetTrackGain(soundTrack_, volume);
+        MIX_SetTrackGain(voice.track_, sound_volume_ * voice.gain_);
     }
 }
 
@@ -254,9 +381,9 @@ float engine::audio::AudioPlayer::getMusicVolume()
 
 float engine::audio::AudioPlayer::getSoundVolume(int channel)
 {
-    if (soundTrack_)
+    if (channel >= 0 && channel < static_cast<int>(voices_.size()))
     {
-        return MIX_GetTrackGain(soundTrack_);
+        return MIX_GetTrackGain(voices_[channel].track_);
     }
-    return 0.0f;
+    return sound_volume_;
 }
@@ -1,6 +1,10 @@
 #pragma once
 #include <string>
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
 #include <entt/entity/fwd.hpp>
+#include <SDL3/SDL_properties.h>
 struct MIX_Track;
 struct MIX_Audio;
 struct MIX_Mixer;
@@ -10,19 +14,82 @@ namespace engine::resource
 }
 namespace engine::audio
 {
+    /// @brief 单个音效的播放设置
+    struct SoundSettings
+    {
+        int priority_{0};      ///< @brief 优先级，声部不足时只能抢占优先级不高于自己的声部
+        int max_instances_{4}; ///< @brief 同时播放的最大数量，超出时替换最早播放的同名音效
+        float gain_{1.0f};     ///< @brief 音量系数（乘以全局音效音量），也用于判断“最安静”的声部
+    };
+
+    /// @brief 同帧音效合并设置（由AudioSystem使用）
+    struct CoalesceSettings
+    {
+        float window_{0.03f};   ///< @brief 合并窗口（秒），同一音效在窗口内只播放一次
+        int max_per_frame_{8};  ///< @brief 每帧最多播放的音效数量，超出的按优先级丢弃
+        bool scale_gain_{true}; ///< @brief 是否按合并数量适当提高音量
+    };
+
+    /// @brief 定位音效设置（由AudioSystem根据发声位置与摄像机计算衰减和声像）
+    struct PositionalSettings
+    {
+        float cull_distance_{320.0f}; ///< @brief 超出视口边缘的距离（像素），达到此距离时音量衰减为0且不再播放
+        float pan_strength_{0.8f};    ///< @brief 声像强度（0为不做左右声道区分，1为视口边缘完全偏向一侧）
+    };
+
+    /// @brief 音效声部统计
+    struct VoiceStats
+    {
+        size_t played_{0};  ///< @brief 播放次数
+        size_t stolen_{0};  ///< @brief 抢占正在播放的声部的次数
+        size_t dropped_{0}; ///< @brief 因没有可用声部而放弃播放的次数
+    };
+
+    /**
+     * @brief 音频播放器
+     *
+     * 音乐使用单独的音轨；音效使用固定数量的预创建音轨（声部）实现多音播放。
+     * 新音效优先使用空闲声部，同名音效达到上限时替换最早的那个；所有声部都在播放时，
+     * 抢占优先级不高于新音效的声部中优先级最低、最安静、最早开始的一个，都更高则放弃播放。
+     */
     class AudioPlayer final
     {
+    public:
+        static constexpr size_t DEFAULT_VOICE_COUNT = 16; ///< @brief 默认音效声部数量
+
     private:
+        /// @brief 音效声部
+        struct Voice
+        {
+            MIX_Track *track_ = nullptr;
+            entt::id_type sound_id_{};
+            int priority_{0};
+            float gain_{1.0f};
+            uint64_t serial_{0}; ///< @brief 开始播放的序号（越小越早）
+        };
+
         engine::resource::ResourceManager *resource_manager_;
         MIX_Mixer *mixer_ = nullptr;
 
         MIX_Track *musicTrack_ = nullptr;
-        MIX_Track *soundTrack_ = nullptr;
+        std::vector<Voice> voices_;                                       ///< @brief 音效声部（预创建的音轨）
+        SDL_PropertiesID sound_props_ = 0;                                ///< @brief 复用的音效播放参数
+        std::unordered_map<entt::id_type, SoundSettings> sound_settings_; ///< @brief 音效ID -> 播放设置
+        float sound_volume_ = 1.0f;                                       ///< @brief 全局音效音量
+        uint64_t play_serial_ = 0;                                        ///< @brief 播放序号计数
+        VoiceStats voice_stats_;
+        CoalesceSettings coalesce_settings_;
+        PositionalSettings positional_settings_;
 
         std::string current_music_;
 
     public:
-        explicit AudioPlayer(engine::resource::ResourceManager *resource_manager);
+        /**
+         * @brief 构造函数，预先创建所有音效声部
+         * @param resource_manager 资源管理器
+         * @param voice_count 音效声部数量（同时播放的音效上限）
+         */
+        explicit AudioPlayer(engine::resource::ResourceManager *resource_manager, size_t voice_count = DEFAULT_VOICE_COUNT);
         ~AudioPlayer();
 
         AudioPlayer(const AudioPlayer &) = delete;
@@ -30,9 +97,29 @@ namespace engine::audio
         AudioPlayer &operator=(const AudioPlayer &) = delete;
         AudioPlayer &operator=(AudioPlayer &&) = delete;
 
-        int playSound(entt::id_type sound_id, int channel = -1);
+        /**
+         * @brief 播放音效
+         * @param sound_id 音效ID
+         * @param channel 指定声部索引，-1表示自动分配
+         * @param gain 额外的音量系数（与音效设置中的系数相乘）
+         * @param pan 声像，-1为完全左声道，0为居中，1为完全右声道
+         * @return 使用的声部索引，失败或被放弃时返回-1
+         */
+        int playSound(entt::id_type sound_id, int channel = -1, float gain = 1.0f, float pan = 0.0f);
 
-        int playSound(entt::hashed_string hashed_path, int channel = -1);
+        int playSound(entt::hashed_string hashed_path, int channel = -1, float gain = 1.0f, float pan = 0.0f);
+
+        /**
+         * @brief 从JSON文件载入音效播放设置，格式为 { "音效名": { "priority": 0, "max_instances": 4, "gain": 1.0 } }
+         * @return 是否载入成功（文件不存在时返回false，全部音效使用默认设置）
+         */
+        bool loadSoundSettings(const std::string &file_path);
+        void setSoundSettings(entt::id_type sound_id, const SoundSettings &settings) { sound_settings_[sound_id] = settings; }
+        const SoundSettings &getSoundSettings(entt::id_type sound_id) const;
+        void setCoalesceSettings(const CoalesceSettings &settings) { coalesce_settings_ = settings; }
+        const CoalesceSettings &getCoalesceSettings() const { return coalesce_settings_; }
+        void setPositionalSettings(const PositionalSettings &settings) { positional_settings_ = settings; }
+        const PositionalSettings &getPositionalSettings() const { return positional_settings_; }
 
         int playMusic(entt::id_type music_id, int loops = -1, int fade_in_ms = 0);
 
@@ -51,5 +138,14 @@ namespace engine::audio
         float getMusicVolume();
 
         float getSoundVolume(int channel = -1);
+
+        size_t getVoiceCount() const { return voices_.size(); }
+        size_t getActiveVoiceCount() const; ///< @brief 正在播放的声部数量
+        const VoiceStats &getVoiceStats() const { return voice_stats_; }
+        void resetVoiceStats() { voice_stats_ = {}; }
+
+    private:
+        int playSoundAudio(MIX_Audio *audio, entt::id_type sound_id, int channel, float gain, float pan); ///< @brief 分配声部并播放
+        int selectVoice(const SoundSettings &settings, entt::id_type sound_id);                           ///< @brief 选择（或抢占）声部，没有可用声部时返回-1
     };
 }
@@ -1,27 +1,33 @@
 #pragma once
 #include "../../engine/utils/math.h"
+#include "../../engine/utils/small_flat_map.h"
 #include <entt/core/hashed_string.hpp>
 #include <entt/entity/entity.hpp>
+#include <cstdint>
+#include <memory>
+#include <vector>
 
 namespace engine::component
 {
     struct AnimationFrame
     {
-        engine::utils::Rect src_rect_{}; ///< @brief 帧源矩形
-        float duration_ms_{100.0f};      ///< @brief 帧间隔（毫秒）
+        engine::utils::Rect src_rect_{};     ///< @brief 帧源矩形
+        float duration_ms_{100.0f};          ///< @brief 帧间隔（毫秒）
+        entt::id_type event_id_{entt::null}; ///< @brief 播放到此帧时发送的动画事件ID（由AnimationClipSet编译时填入）
         AnimationFrame(engine::utils::Rect src_rect, float duration_ms = 100.0f)
             : src_rect_(std::move(src_rect)), duration_ms_(duration_ms) {}
     };
 
+    /// @brief 动画描述（编译为AnimationClipSet之前的输入数据）
     struct Animation
     {
         std::vector<AnimationFrame> frames_;            ///< @brief 动画帧
-        std::unordered_map<int, entt::id_type> events_; ///< @brief 动画事件，键为帧索引，值为事件ID
-        float total_duration_ms_{};                     ///< @brief 动画总时长（毫秒）
-        bool loop_{true};                               ///< @brief 是否循环
+        engine::utils::SmallFlatMap<int, entt::id_type> events_; ///< @brief 动画事件，键为帧索引，值为事件ID
+        float total_duration_ms_{};                              ///< @brief 动画总时长（毫秒）
+        bool loop_{true};                                        ///< @brief 是否循环
 
         Animation(std::vector<AnimationFrame> frames,
-                  std::unordered_map<int, entt::id_type> events = {},
+                  engine::utils::SmallFlatMap<int, entt::id_type> events = {},
                   bool loop = true) : frames_(std::move(frames)),
                                       events_(std::move(events)),
                                       loop_(loop)
@@ -35,23 +41,94 @@ namespace engine::component
         }
     };
 
+    /// @brief 动画片段，帧数据保存在所属AnimationClipSet的连续帧表中
+    struct AnimationClip
+    {
+        entt::id_type id_{entt::null}; ///< @brief 动画名称ID
+        uint32_t first_frame_{};       ///< @brief 在帧表中的起始位置
+        uint32_t frame_count_{};       ///< @brief 帧数量
+        float total_duration_ms_{};    ///< @brief 动画总时长（毫秒）
+        bool loop_{true};              ///< @brief 默认是否循环
+    };
+
+    /**
+     * @brief 不可变的动画片段集合，按蓝图（或图块）编译一次，由所有使用它的实体共享
+     *
+     * 所有片段的帧保存在同一个连续数组中，动画事件直接写入对应帧，播放时不需要查找关联容器。
+     */
+    class AnimationClipSet
+    {
+        std::vector<AnimationFrame> frames_; ///< @brief 所有片段的帧（按片段连续排列）
+        std::vector<AnimationClip> clips_;   ///< @brief 片段列表（数量很少，线性查找即可）
+
+    public:
+        static constexpr uint32_t INVALID_CLIP = UINT32_MAX; ///< @brief 无效的片段索引
+
+        /// @brief 添加一个片段（只在编译阶段调用）
+        void addClip(entt::id_type id, const Animation &animation)
+        {
+            AnimationClip clip{id, static_cast<uint32_t>(frames_.size()), static_cast<uint32_t>(animation.frames_.size()),
+                               animation.total_duration_ms_, animation.loop_};
+            frames_.insert(frames_.end(), animation.frames_.begin(), animation.frames_.end());
+            for (const auto &[frame_index, event_id] : animation.events_)
+            {
+                if (frame_index >= 0 && static_cast<uint32_t>(frame_index) < clip.frame_count_)
+                {
+                    frames_[clip.first_frame_ + frame_index].event_id_ = event_id;
+                }
+            }
+            clips_.push_back(clip);
+        }
+
+        /// @brief 根据动画名称ID查找片段索引，不存在时返回INVALID_CLIP
+        uint32_t findClip(entt::id_type id) const
+        {
+            for (uint32_t i = 0; i < clips_.size(); ++i)
+            {
+                if (clips_[i].id_ == id)
+                    return i;
+            }
+            return INVALID_CLIP;
+        }
+
+        const AnimationClip &getClip(uint32_t clip_index) const { return clips_[clip_index]; }
+        const AnimationFrame &getFrame(const AnimationClip &clip, size_t frame_index) const { return frames_[clip.first_frame_ + frame_index]; }
+        size_t getClipCount() const { return clips_.size(); }
+        size_t getFrameCount() const { return frames_.size(); }
+    };
+
+    /**
+     * @brief 动画组件，只保存播放状态，帧数据来自共享的AnimationClipSet
+     */
     struct AnimationComponent
     {
-        std::unordered_map<entt::id_type, Animation> animations_; ///< @brief 动画集合
-        entt::id_type current_animation_id_{entt::null};          ///< @brief 当前播放的动画名称
-        size_t current_frame_index_{};                            ///< @brief 当前播放的帧索引
-        float current_time_ms_{};                                 ///< @brief 当前播放时间（毫秒）
-        float speed_{1.0f};
+        std::shared_ptr<const AnimationClipSet> clip_set_;            ///< @brief 共享的动画片段集合
+        uint32_t current_clip_index_{AnimationClipSet::INVALID_CLIP}; ///< @brief 当前播放的片段索引
+        size_t current_frame_index_{};                                ///< @brief 当前播放的帧索引
+        float current_time_ms_{};                                     ///< @brief 当前播放时间（毫秒）
+        float speed_{1.0f};                                           ///< @brief 播放速度
+        bool loop_{true};                                             ///< @brief 当前动画是否循环（可被PlayAnimationEvent覆盖）
 
-        AnimationComponent(std::unordered_map<entt::id_type, Animation> animations,
+        AnimationComponent(std::shared_ptr<const AnimationClipSet> clip_set,
                            entt::id_type current_animation_id,
-                           size_t current_frame_index = 0,
-                           float current_time_ms = 0.0f,
-                           float speed = 1.0f) : animations_(std::move(animations)),
-                                                 current_animation_id_(current_animation_id),
-                                                 current_frame_index_(current_frame_index),
-                                                 current_time_ms_(current_time_ms),
-                                                 speed_(speed) {} ///< @brief 播放速度
+                           float speed = 1.0f) : clip_set_(std::move(clip_set)),
+                                                 speed_(speed)
+        {
+            play(current_animation_id);
+        }
+
+        /// @brief 切换到指定动画并从头播放，循环设置使用片段默认值
+        void play(entt::id_type animation_id)
+        {
+            current_clip_index_ = clip_set_ ? clip_set_->findClip(animation_id) : AnimationClipSet::INVALID_CLIP;
+            current_frame_index_ = 0;
+            current_time_ms_ = 0.0f;
+            loop_ = hasClip() ? clip_set_->getClip(current_clip_index_).loop_ : true;
+        }
+
+        bool hasClip() const { return current_clip_index_ != AnimationClipSet::INVALID_CLIP; }
+        /// @brief 当前播放的动画名称ID
+        entt::id_type getCurrentAnimationId() const { return hasClip() ? clip_set_->getClip(current_clip_index_).id_ : entt::id_type{entt::null}; }
     };
 
-}
\ No newline at end of file
+}
@@ -1,12 +1,12 @@
 #pragma once
+#include "../utils/small_flat_map.h"
 #include <entt/entity/fwd.hpp>
-#include <unordered_map>
 
 namespace engine::component
 {
     struct AudioComponent
     {
-        std::unordered_map<entt::id_type, entt::id_type> sounds_;
+        engine::utils::SmallFlatMap<entt::id_type, entt::id_type> sounds_; ///< @brief 音效键 -> 音效ID（数量很少，使用扁平映射）
     };
 
 }
\ No newline at end of file
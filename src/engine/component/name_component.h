@@ -1,5 +1,5 @@
 #pragma once
-#include <string>
+#include "../utils/string_interner.h"
 #include <entt/entity/entity.hpp>
 
 namespace engine::component
@@ -7,6 +7,6 @@ namespace engine::component
     struct NameComponent
     {
         entt::id_type name_id_{entt::null};
-        std::string name_;
+        engine::utils::InternedString name_; ///< @brief 名称（驻留字符串）
     };
 }
\ No newline at end of file
@@ -1,29 +1,24 @@
 #pragma once
 #include "../utils/math.h"
+#include "../resource/texture_handle.h"
 #include <SDL3/SDL_rect.h>
-#include <entt/core/hashed_string.hpp>
-#include <entt/entity/entity.hpp>
 #include <glm/vec2.hpp>
 #include <glm/common.hpp>
 #include <utility>
-#include <string>
+#include <string_view>
 
 namespace engine::component
 {
     struct Sprite
     {
-        entt::id_type texture_id_{entt::null}; ///< @brief 纹理ID
-        std::string texture_path_;             ///< @brief 纹理路径
-        engine::utils::Rect src_rect_{};       ///< @brief 源矩形
-        bool is_flipped_{false};               ///< @brief 是否翻转
+        engine::resource::TextureHandle texture_; ///< @brief 纹理句柄（驻留的纹理路径）
+        engine::utils::Rect src_rect_{};          ///< @brief 源矩形
+        bool is_flipped_{false};                  ///< @brief 是否翻转
 
         Sprite() = default; ///< @brief 空的构造函数
 
-        Sprite(std::string texture_path, engine::utils::Rect source_rect, bool is_flipped = false)
-            : texture_path_(std::move(texture_path)), src_rect_(std::move(source_rect)), is_flipped_(is_flipped)
-        {
-            texture_id_ = entt::hashed_string(texture_path_.c_str());
-        }
+        Sprite(std::string_view texture_path, engine::utils::Rect source_rect, bool is_flipped = false)
+            : texture_(texture_path), src_rect_(std::move(source_rect)), is_flipped_(is_flipped) {}
     };
     struct SpriteComponent
     {
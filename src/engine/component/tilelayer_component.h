@@ -4,6 +4,7 @@
 #include <entt/entity/entity.hpp>
 #include <glm/vec2.hpp>
 #include <vector>
+#include <memory>
 #include <utility>
 #include <optional>
 #include <SDL3/SDL_rect.h>
@@ -28,14 +29,14 @@ namespace engine::component
     {
         engine::component::Sprite sprite_;                      ///< @brief 精灵
         engine::component::TileType type_;                      ///< @brief 类型
-        std::optional<engine::component::Animation> animation_; ///< @brief 动画（支持Tiled动画图块）
+        std::shared_ptr<const AnimationClipSet> animation_;     ///< @brief 动画（支持Tiled动画图块，同一图块的所有实体共享）
         std::optional<nlohmann::json> properties_;              ///< @brief 属性（存放自定义属性，方便LevelLoader解析）
 
         TileInfo() = default;
 
         TileInfo(engine::component::Sprite sprite,
                  engine::component::TileType type,
-                 std::optional<engine::component::Animation> animation = std::nullopt,
+                 std::shared_ptr<const AnimationClipSet> animation = nullptr,
                  std::optional<nlohmann::json> properties = std::nullopt) : sprite_(std::move(sprite)),
                                                                             type_(type),
                                                                             animation_(std::move(animation)),
@@ -2,6 +2,7 @@
 #include <nlohmann/json.hpp>
 #include <spdlog/spdlog.h>
 #include <fstream>
+#include <algorithm>
 engine::core::Config::Config(const std::string &file_path)
 {
     loadFromFile(file_path);
@@ -80,6 +81,7 @@ void engine::core::Config::fromJson(const nlohmann::json &j)
         /* code */
         const auto &perf_config = j["performance"];
         target_fps_ = perf_config.value("target_fps", target_fps_);
+        frame_arena_kb_ = std::max(1, perf_config.value("frame_arena_kb", frame_arena_kb_));
         if (target_fps_ < 0)
         {
             spdlog::warn("Target FPS must be greater than 0");
@@ -91,6 +93,17 @@ void engine::core::Config::fromJson(const nlohmann::json &j)
         const auto &audio_config = j["audio"];
         music_volume_ = audio_config.value("music_volume", music_volume_);
         sound_volume_ = audio_config.value("sound_volume", sound_volume_);
+        sound_voices_ = audio_config.value("sound_voices", sound_voices_);
+        if (sound_voices_ < 1)
+        {
+            spdlog::warn("Sound voices must be greater than 0");
+            sound_voices_ = 1;
+        }
+        sound_coalesce_ms_ = std::max(0, audio_config.value("sound_coalesce_ms", sound_coalesce_ms_));
+        max_sounds_per_frame_ = std::max(1, audio_config.value("max_sounds_per_frame", max_sounds_per_frame_));
+        sound_coalesce_gain_ = audio_config.value("sound_coalesce_gain", sound_coalesce_gain_);
+        sound_cull_distance_ = std::max(1.0f, audio_config.value("sound_cull_distance", sound_cull_distance_));
+        sound_pan_strength_ = std::clamp(audio_config.value("sound_pan_strength", sound_pan_strength_), 0.0f, 1.0f);
     }
     if (j.contains("input_mappings") && j["input_mappings"].is_object())
     {
@@ -137,6 +150,7 @@ nlohmann::ordered_json engine::core::Config::toJson() const
             "performance",
             {
                 {"target_fps", target_fps_},
+                {"frame_arena_kb", frame_arena_kb_},
             },
         },
         {
@@ -144,6 +158,12 @@ nlohmann::ordered_json engine::core::Config::toJson() const
             {
                 {"music_volume", music_volume_},
                 {"sound_volume", sound_volume_},
+                {"sound_voices", sound_voices_},
+                {"sound_coalesce_ms", sound_coalesce_ms_},
+                {"max_sounds_per_frame", max_sounds_per_frame_},
+                {"sound_coalesce_gain", sound_coalesce_gain_},
+                {"sound_cull_distance", sound_cull_distance_},
+                {"sound_pan_strength", sound_pan_strength_},
             },
         },
         {"input_mappings",
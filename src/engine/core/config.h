@@ -19,8 +19,15 @@ namespace engine::core
 
         bool vsync_enabled_ = true;
         int target_fps_ = 60;
+        int frame_arena_kb_ = 256; ///< @brief 帧内存（每帧重置的线性分配器）大小（KB）
         float music_volume_ = 0.5f;
         float sound_volume_ = 0.5f;
+        int sound_voices_ = 16;              ///< @brief 音效声部数量（同时播放的音效上限）
+        int sound_coalesce_ms_ = 30;         ///< @brief 同一音效的合并窗口（毫秒）
+        int max_sounds_per_frame_ = 8;       ///< @brief 每帧最多播放的音效数量
+        bool sound_coalesce_gain_ = true;    ///< @brief 是否按合并数量提高音量
+        float sound_cull_distance_ = 320.0f; ///< @brief 发声位置超出视口多远（像素）后不再播放
+        float sound_pan_strength_ = 0.8f;    ///< @brief 定位音效的声像强度（0~1）
 
         /// @brief 存储动作名称到SDL Scancode名称的列表映射
         std::unordered_map<std::string, std::vector<std::string>> _input_mappings =
@@ -20,6 +20,11 @@ namespace engine::audio
 {
     class AudioPlayer;
 }
+namespace engine::utils
+{
+    class DispatcherProfiler;
+    class FrameArena;
+}
 namespace engine::core
 {
     class GameState;
@@ -43,7 +48,9 @@ namespace engine::core
         engine::audio::AudioPlayer &audio_player_;
         engine::render::TextRenderer &text_renderer_;
         engine::core::GameState &game_state_;
-        engine::core::Time &time_; ///< @brief 时间
+        engine::core::Time &time_;                               ///< @brief 时间
+        engine::utils::DispatcherProfiler &dispatcher_profiler_; ///< @brief 事件分发统计
+        engine::utils::FrameArena &frame_arena_;                 ///< @brief 帧内存（每帧重置）
 
     public:
         Context(entt::dispatcher &dispatcher,
@@ -54,7 +61,9 @@ namespace engine::core
                 engine::render::TextRenderer &text_renderer,
                 engine::audio::AudioPlayer &audio_player,
                 engine::core::GameState &game_state,
-                engine::core::Time &time);
+                engine::core::Time &time,
+                engine::utils::DispatcherProfiler &dispatcher_profiler,
+                engine::utils::FrameArena &frame_arena);
         Context(const Context &) = delete;
         Context(Context &&) = delete;
         Context &operator=(const Context &) = delete;
@@ -69,5 +78,7 @@ namespace engine::core
         engine::audio::AudioPlayer &getAudioPlayer() const { return audio_player_; }
         engine::core::GameState &getGameState() const { return game_state_; }
         engine::core::Time &getTime() const { return time_; } ///< @brief 获取时间
+        engine::utils::DispatcherProfiler &getDispatcherProfiler() const { return dispatcher_profiler_; }
+        engine::utils::FrameArena &getFrameArena() const { return frame_arena_; } ///< @brief 获取帧内存（只用于当前帧内的临时容器）
     };
 }
\ No newline at end of file
@@ -16,6 +16,9 @@
 #include "../scene/scene_manager.h"
 #include "config.h"
 #include "../utils/events.h"
+#include "../utils/dispatcher_profiler.h"
+#include "../utils/frame_arena.h"
+#include "../utils/alloc_tracker.h"
 #include <entt/signal/dispatcher.hpp>
 #include <imgui.h>
 #include <imgui_impl_sdl3.h>
@@ -45,11 +48,26 @@ namespace engine::core
         {
             time_->update();
             float dt = time_->getDeltaTime();
-            handleEvents();
-            update(dt);
-            render();
-            // 分发事件（让新创建的实体先更新再渲染）
-            dispatcher_->update();
+            {
+                MW_ALLOC_SCOPE("events");
+                handleEvents();
+            }
+            {
+                MW_ALLOC_SCOPE("update");
+                update(dt);
+            }
+            {
+                MW_ALLOC_SCOPE("render");
+                render();
+            }
+            {
+                MW_ALLOC_SCOPE("dispatch");
+                // 分发事件（让新创建的实体先更新再渲染），同时记录各事件类型的统计
+                dispatcher_profiler_->update();
+            }
+            // 帧结束，回收本帧的临时内存，保存本帧的堆分配统计
+            frame_arena_->reset();
+            engine::utils::AllocTracker::endFrame();
         }
         close();
     }
@@ -64,6 +82,16 @@ namespace engine::core
         try
         {
             dispatcher_ = std::make_unique<entt::dispatcher>();
+            dispatcher_profiler_ = std::make_unique<engine::utils::DispatcherProfiler>(*dispatcher_);
+            dispatcher_profiler_->trackAll<engine::utils::QuitEvent,
+                                           engine::utils::PopSceneEvent,
+                                           engine::utils::PushSceneEvent,
+                                           engine::utils::ReplaceSceneEvent,
+                                           engine::utils::PlayAnimationEvent,
+                                           engine::utils::AnimationFinishedEvent,
+                                           engine::utils::AnimationEvent,
+                                           engine::utils::PlaySoundEvent,
+                                           engine::utils::RenderTargetsResetEvent>();
         }
         catch (const std::exception &e)
         {
@@ -159,13 +187,18 @@ namespace engine::core
     {
         try
         {
-            audio_player_ = std::make_unique<engine::audio::AudioPlayer>(resource_manager_.get());
+            audio_player_ = std::make_unique<engine::audio::AudioPlayer>(resource_manager_.get(), static_cast<size_t>(config_->sound_voices_));
         }
         catch (const std::exception &e)
         {
             spdlog::error("AudioPlayer init failed: {},{},{}", e.what(), __FILE__, __LINE__);
             return false;
         }
+        audio_player_->loadSoundSettings("assets/data/sound_settings.json");
+        audio_player_->setCoalesceSettings({static_cast<float>(config_->sound_coalesce_ms_) / 1000.0f,
+                                            config_->max_sounds_per_frame_,
+                                            config_->sound_coalesce_gain_});
+        audio_player_->setPositionalSettings({config_->sound_cull_distance_, config_->sound_pan_strength_});
 
         return true;
     }
@@ -247,9 +280,10 @@ namespace engine::core
     {
         try
         {
+            frame_arena_ = std::make_unique<engine::utils::FrameArena>(static_cast<size_t>(config_->frame_arena_kb_) * 1024);
             context_ = std::make_unique<engine::core::Context>(*dispatcher_, *input_manager_, *renderer_, *resource_manager_, *camera_,
                                                                *text_renderer_, *audio_player_, *game_state_,
-                                                               *time_);
+                                                               *time_, *dispatcher_profiler_, *frame_arena_);
         }
         catch (const std::exception &e)
         {
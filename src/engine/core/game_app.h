@@ -28,6 +28,11 @@ namespace engine::audio
 {
     class AudioPlayer;
 }
+namespace engine::utils
+{
+    class DispatcherProfiler;
+    class FrameArena;
+}
 namespace engine::core
 {
     class Time;
@@ -46,6 +51,7 @@ namespace engine::core
         std::function<void(engine::core::Context &)> scene_setup_func_;
 
         std::unique_ptr<entt::dispatcher> dispatcher_; // 事件分发器
+        std::unique_ptr<engine::utils::DispatcherProfiler> dispatcher_profiler_; // 事件分发统计（负责每帧分发事件）
         std::unique_ptr<engine::core::Time> time_{nullptr};
         std::unique_ptr<engine::resource::ResourceManager> resource_manager_{nullptr};
         std::unique_ptr<engine::render::Renderer> renderer_{nullptr};
@@ -57,6 +63,7 @@ namespace engine::core
         std::unique_ptr<engine::scene::SceneManager> scene_manager_{nullptr};
         std::unique_ptr<engine::audio::AudioPlayer> audio_player_{nullptr};
         std::unique_ptr<engine::core::GameState> game_state_{nullptr};
+        std::unique_ptr<engine::utils::FrameArena> frame_arena_{nullptr}; // 帧内存（每帧结束时重置）
 
     public:
         GameApp();
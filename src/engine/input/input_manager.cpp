@@ -103,6 +103,13 @@ glm::vec2 engine::input::InputManager::getLogicalMousePosition() const
 
 void engine::input::InputManager::processEvent(const SDL_Event &event)
 {
+    // 渲染目标/设备重置不是输入事件，不受 ImGui 捕获鼠标的影响，立即通知（本帧渲染前完成处理）
+    if (event.type == SDL_EVENT_RENDER_TARGETS_RESET || event.type == SDL_EVENT_RENDER_DEVICE_RESET)
+    {
+        spdlog::warn("Render targets reset (device reset: {})", event.type == SDL_EVENT_RENDER_DEVICE_RESET);
+        dispatcher_->trigger(engine::utils::RenderTargetsResetEvent{event.type == SDL_EVENT_RENDER_DEVICE_RESET});
+        return;
+    }
     // 如果 ImGui 捕获了鼠标，则不处理该事件(避免穿透到游戏中)
     if (ImGui::GetIO().WantCaptureMouse)
     {
@@ -8,7 +8,7 @@
 #include "../component/render_component.h"
 #include "../resource/resource_manager.h"
 #include <entt/entt.hpp>
-#include <spdlog/spdlog.h>
+#include "../utils/log.h"
 
 engine::loader::BasicEntityBuilder::BasicEntityBuilder(engine::loader::LevelLoader &level_loader, engine::core::Context &context, entt::registry &registry)
     : level_loader_(level_loader), context_(context), registry_(registry)
@@ -24,11 +24,11 @@ engine::loader::BasicEntityBuilder *engine::loader::BasicEntityBuilder::configur
     reset();
     if (!object_json)
     {
-        spdlog::error("failed to configure basic entity builder, object_json is nullptr");
+        MW_LOG_ERROR(LOADER, "failed to configure basic entity builder, object_json is nullptr");
         return nullptr;
     }
     object_json_ = object_json;
-    spdlog::trace("configured basic entity builder");
+    MW_LOG_TRACE(LOADER, "configured basic entity builder");
     return this;
 }
 
@@ -37,13 +37,13 @@ engine::loader::BasicEntityBuilder *engine::loader::BasicEntityBuilder::configur
     reset();
     if (!object_json || !tile_info)
     {
-        spdlog::error("failed to configure basic entity builder, object_json or tile_info is nullptr");
+        MW_LOG_ERROR(LOADER, "failed to configure basic entity builder, object_json or tile_info is nullptr");
         return nullptr;
     }
 
     object_json_ = object_json;
     tile_info_ = tile_info;
-    spdlog::trace("configured basic entity builder");
+    MW_LOG_TRACE(LOADER, "configured basic entity builder");
     return this;
 }
 
@@ -52,12 +52,12 @@ engine::loader::BasicEntityBuilder *engine::loader::BasicEntityBuilder::configur
     reset();
     if (!tile_info)
     {
-        spdlog::error("failed to configure basic entity builder, tile_info is nullptr");
+        MW_LOG_ERROR(LOADER, "failed to configure basic entity builder, tile_info is nullptr");
         return nullptr;
     }
     index_ = index;
     tile_info_ = tile_info;
-    spdlog::trace("configured basic entity builder");
+    MW_LOG_TRACE(LOADER, "configured basic entity builder");
     return this;
 }
 
@@ -65,7 +65,7 @@ engine::loader::BasicEntityBuilder *engine::loader::BasicEntityBuilder::build()
 {
     if (!object_json_ && !tile_info_)
     {
-        spdlog::error("object_json 和 tile_info 都为空，无法进行构建");
+        MW_LOG_ERROR(LOADER, "object_json 和 tile_info 都为空，无法进行构建");
         return this;
     }
 
@@ -97,7 +97,7 @@ void engine::loader::BasicEntityBuilder::reset()
 
 void engine::loader::BasicEntityBuilder::buildBase()
 {
-    spdlog::trace("create basic entity");
+    MW_LOG_TRACE(LOADER, "create basic entity");
     // 创建一个实体并添加NameComponent组件
     entity_id_ = registry_.create();
     if (object_json_ && object_json_->contains("name"))
@@ -105,25 +105,25 @@ void engine::loader::BasicEntityBuilder::buildBase()
         std::string name = object_json_->value("name", "");
         entt::id_type name_id = entt::hashed_string(name.c_str());
         registry_.emplace<engine::component::NameComponent>(entity_id_, name_id, name);
-        spdlog::trace("create basic entity with name: {}", object_json_->value("name", ""));
+        MW_LOG_TRACE(LOADER, "create basic entity with name: {}", object_json_->value("name", ""));
     }
 }
 
 void engine::loader::BasicEntityBuilder::buildSprite()
 {
-    spdlog::trace("create sprite component");
+    MW_LOG_TRACE(LOADER, "create sprite component");
     // 如果是自定义形状对象，则不需要SpriteComponent
     if (!tile_info_)
         return;
     // 创建Sprite时候确保纹理加载
     auto &resource_manager = context_.getResourceManager();
-    resource_manager.loadTexture(tile_info_->sprite_.texture_id_, tile_info_->sprite_.texture_path_);
+    resource_manager.loadTexture(tile_info_->sprite_.texture_);
     registry_.emplace<engine::component::SpriteComponent>(entity_id_, tile_info_->sprite_);
 }
 
 void engine::loader::BasicEntityBuilder::buildTransform()
 {
-    spdlog::trace("create transform component");
+    MW_LOG_TRACE(LOADER, "create transform component");
     glm::vec2 scale = glm::vec2(1.0f);
     float rotation = 0.0f;
 
@@ -157,7 +157,7 @@ void engine::loader::BasicEntityBuilder::buildTransform()
 
 void engine::loader::BasicEntityBuilder::buildRender()
 {
-    spdlog::trace("create renderer component");
+    MW_LOG_TRACE(LOADER, "create renderer component");
     int layer = level_loader_.getCurrentLayer();
     float depth = position_.y;
     registry_.emplace<engine::component::RenderComponent>(entity_id_, layer, depth);
@@ -165,22 +165,18 @@ void engine::loader::BasicEntityBuilder::buildRender()
 
 void engine::loader::BasicEntityBuilder::buildAnimation()
 {
-    spdlog::trace("create animation component");
-    // 如果存在动画，其信息已经解析并保存在tile_info_中
+    MW_LOG_TRACE(LOADER, "create animation component");
+    // 如果存在动画，其片段集合已经编译并保存在tile_info_中（同一图块共享）
     if (tile_info_ && tile_info_->animation_)
     {
-        // 创建动画map
-        std::unordered_map<entt::id_type, engine::component::Animation> animations;
         auto animation_id = entt::hashed_string("tile"); // 图块动画名称默认为"tile"
-        animations.emplace(animation_id, std::move(tile_info_->animation_.value()));
-        // 通过动画map创建AnimationComponent，并添加
-        registry_.emplace<engine::component::AnimationComponent>(entity_id_, std::move(animations), animation_id);
+        registry_.emplace<engine::component::AnimationComponent>(entity_id_, tile_info_->animation_, animation_id);
     }
 }
 
 void engine::loader::BasicEntityBuilder::buildAudio()
 {
-    spdlog::trace("create audio component");
+    MW_LOG_TRACE(LOADER, "create audio component");
 }
 
 template <typename T>
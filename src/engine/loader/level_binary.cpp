@@ -0,0 +1,364 @@
+#include "level_binary.h"
+#include <spdlog/spdlog.h>
+#include <filesystem>
+#include <fstream>
+
+namespace engine::loader
+{
+    namespace
+    {
+        constexpr char MAGIC[4] = {'M', 'W', 'L', 'V'};
+
+        /// @brief 顺序写入小端序数据
+        class BinaryWriter
+        {
+            std::string buffer_;
+
+        public:
+            void writeU32(uint32_t value)
+            {
+                for (int i = 0; i < 4; ++i)
+                {
+                    buffer_.push_back(static_cast<char>((value >> (i * 8)) & 0xFF));
+                }
+            }
+            void writeU64(uint64_t value)
+            {
+                writeU32(static_cast<uint32_t>(value & 0xFFFFFFFF));
+                writeU32(static_cast<uint32_t>(value >> 32));
+            }
+            void writeBytes(const void *data, size_t size)
+            {
+                buffer_.append(static_cast<const char *>(data), size);
+            }
+            void writeString(std::string_view value)
+            {
+                writeU32(static_cast<uint32_t>(value.size()));
+                writeBytes(value.data(), value.size());
+            }
+            void writeCbor(const nlohmann::json &value)
+            {
+                const auto bytes = nlohmann::json::to_cbor(value);
+                writeU32(static_cast<uint32_t>(bytes.size()));
+                writeBytes(bytes.data(), bytes.size());
+            }
+            const std::string &getBuffer() const { return buffer_; }
+        };
+
+        /// @brief 顺序读取小端序数据，越界时 ok() 返回 false，之后的读取均返回默认值
+        class BinaryReader
+        {
+            const unsigned char *data_;
+            size_t size_;
+            size_t pos_{0};
+            bool ok_{true};
+
+        public:
+            BinaryReader(const std::string &buffer)
+                : data_(reinterpret_cast<const unsigned char *>(buffer.data())), size_(buffer.size()) {}
+
+            bool ok() const { return ok_; }
+            bool atEnd() const { return pos_ == size_; }
+
+            const unsigned char *readBytes(size_t size)
+            {
+                if (!ok_ || size > size_ - pos_)
+                {
+                    ok_ = false;
+                    return nullptr;
+                }
+                const auto *result = data_ + pos_;
+                pos_ += size;
+                return result;
+            }
+            uint32_t readU32()
+            {
+                const auto *bytes = readBytes(4);
+                if (!bytes)
+                    return 0;
+                return static_cast<uint32_t>(bytes[0]) |
+                       static_cast<uint32_t>(bytes[1]) << 8 |
+                       static_cast<uint32_t>(bytes[2]) << 16 |
+                       static_cast<uint32_t>(bytes[3]) << 24;
+            }
+            uint64_t readU64()
+            {
+                const uint64_t low = readU32();
+                const uint64_t high = readU32();
+                return low | high << 32;
+            }
+            std::string readString()
+            {
+                const auto size = readU32();
+                const auto *bytes = readBytes(size);
+                return bytes ? std::string(reinterpret_cast<const char *>(bytes), size) : std::string();
+            }
+            nlohmann::json readCbor()
+            {
+                const auto size = readU32();
+                const auto *bytes = readBytes(size);
+                if (!bytes)
+                    return nlohmann::json();
+                // allow_exceptions = false：格式错误时返回 discarded 值
+                auto result = nlohmann::json::from_cbor(bytes, bytes + size, true, false);
+                if (result.is_discarded())
+                {
+                    ok_ = false;
+                    return nlohmann::json();
+                }
+                return result;
+            }
+        };
+
+        bool readFile(const std::filesystem::path &path, std::string &content)
+        {
+            std::ifstream file(path, std::ios::binary);
+            if (!file.is_open())
+                return false;
+            file.seekg(0, std::ios::end);
+            content.resize(static_cast<size_t>(file.tellg()));
+            file.seekg(0, std::ios::beg);
+            file.read(content.data(), static_cast<std::streamsize>(content.size()));
+            return static_cast<bool>(file);
+        }
+
+        /// @brief 获取文件修改时间（不存在时返回0）
+        int64_t getFileMtime(const std::filesystem::path &path)
+        {
+            std::error_code ec;
+            const auto time = std::filesystem::last_write_time(path, ec);
+            return ec ? 0 : static_cast<int64_t>(time.time_since_epoch().count());
+        }
+    }
+
+    bool LevelBinary::loadFromFile(const std::string &path)
+    {
+        // 整个文件一次性读入
+        std::string buffer;
+        if (!readFile(path, buffer))
+        {
+            spdlog::error("Failed to read binary level: {}", path);
+            return false;
+        }
+
+        BinaryReader reader(buffer);
+        const auto *magic = reader.readBytes(sizeof(MAGIC));
+        if (!magic || std::char_traits<char>::compare(reinterpret_cast<const char *>(magic), MAGIC, sizeof(MAGIC)) != 0)
+        {
+            spdlog::error("Invalid binary level header: {}", path);
+            return false;
+        }
+        if (const auto version = reader.readU32(); version != VERSION)
+        {
+            spdlog::warn("Binary level version mismatch: {}, file: {}, expected: {}", path, version, VERSION);
+            return false;
+        }
+
+        header_ = reader.readCbor();
+
+        tilesets_.clear();
+        const auto tileset_count = reader.readU32();
+        for (uint32_t i = 0; i < tileset_count && reader.ok(); ++i)
+        {
+            Tileset tileset;
+            tileset.first_gid_ = static_cast<int>(reader.readU32());
+            tileset.source_ = reader.readString();
+            tileset.source_mtime_ = static_cast<int64_t>(reader.readU64());
+            tileset.data_ = reader.readCbor();
+            tilesets_.push_back(std::move(tileset));
+        }
+
+        layers_.clear();
+        const auto layer_count = reader.readU32();
+        for (uint32_t i = 0; i < layer_count && reader.ok(); ++i)
+        {
+            TiledLayer layer;
+            layer.meta_ = reader.readCbor();
+            const auto gid_count = reader.readU32();
+            const auto *gids = reader.readBytes(static_cast<size_t>(gid_count) * 4);
+            if (gids)
+            {
+                layer.gids_.resize(gid_count);
+                for (uint32_t j = 0; j < gid_count; ++j)
+                {
+                    layer.gids_[j] = static_cast<uint32_t>(gids[j * 4]) |
+                                     static_cast<uint32_t>(gids[j * 4 + 1]) << 8 |
+                                     static_cast<uint32_t>(gids[j * 4 + 2]) << 16 |
+                                     static_cast<uint32_t>(gids[j * 4 + 3]) << 24;
+                }
+            }
+            layers_.push_back(std::move(layer));
+        }
+
+        if (!reader.ok() || !reader.atEnd())
+        {
+            spdlog::error("Corrupted binary level: {}", path);
+            return false;
+        }
+        return true;
+    }
+
+    bool LevelBinary::saveToFile(const std::string &path) const
+    {
+        BinaryWriter writer;
+        writer.writeBytes(MAGIC, sizeof(MAGIC));
+        writer.writeU32(VERSION);
+        writer.writeCbor(header_);
+
+        writer.writeU32(static_cast<uint32_t>(tilesets_.size()));
+        for (const auto &tileset : tilesets_)
+        {
+            writer.writeU32(static_cast<uint32_t>(tileset.first_gid_));
+            writer.writeString(tileset.source_);
+            writer.writeU64(static_cast<uint64_t>(tileset.source_mtime_));
+            writer.writeCbor(tileset.data_);
+        }
+
+        writer.writeU32(static_cast<uint32_t>(layers_.size()));
+        for (const auto &layer : layers_)
+        {
+            writer.writeCbor(layer.meta_);
+            writer.writeU32(static_cast<uint32_t>(layer.gids_.size()));
+            for (const auto gid : layer.gids_)
+            {
+                writer.writeU32(gid);
+            }
+        }
+
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file.is_open())
+        {
+            spdlog::error("Failed to open binary level for writing: {}", path);
+            return false;
+        }
+        const auto &buffer = writer.getBuffer();
+        file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        if (!file)
+        {
+            spdlog::error("Failed to write binary level: {}", path);
+            return false;
+        }
+        return true;
+    }
+
+    bool LevelBinary::loadFromMap(const std::string &map_path)
+    {
+        std::string content;
+        if (!readFile(map_path, content))
+        {
+            spdlog::error("Failed to open map file: {}", map_path);
+            return false;
+        }
+
+        // 1. 解析地图，收集头信息与图层
+        header_ = nlohmann::json::object();
+        tilesets_.clear();
+        layers_.clear();
+        nlohmann::json tilesets_json = nlohmann::json::array();
+        TiledMapParser parser([&](const nlohmann::json &header)
+                              {
+                                  header_ = header;
+                                  if (header.contains("tilesets") && header["tilesets"].is_array())
+                                  {
+                                      tilesets_json = header["tilesets"];
+                                  }
+                                  header_.erase("tilesets"); },
+                              [&](TiledLayer &layer)
+                              { layers_.push_back(std::move(layer)); });
+        if (!parser.parse(content))
+        {
+            spdlog::error("Failed to parse map file: {}, error: {}", map_path, parser.getError());
+            return false;
+        }
+        if (!parser.hasLayers())
+        {
+            spdlog::error("map not has layers: {}", map_path);
+            return false;
+        }
+
+        // 2. 内嵌引用的图块集 (.tsj 路径保持相对地图文件，运行时再解析)
+        const auto map_dir = std::filesystem::path(map_path).parent_path();
+        for (const auto &tileset_json : tilesets_json)
+        {
+            if (!tileset_json.contains("source") || !tileset_json["source"].is_string() ||
+                !tileset_json.contains("firstgid") || !tileset_json["firstgid"].is_number_integer())
+            {
+                spdlog::error("tilesets not has source or firstgid: {}", map_path);
+                return false;
+            }
+            Tileset tileset;
+            tileset.first_gid_ = tileset_json["firstgid"].get<int>();
+            tileset.source_ = tileset_json["source"].get<std::string>();
+
+            const auto tileset_path = map_dir / tileset.source_;
+            std::string tileset_content;
+            if (!readFile(tileset_path, tileset_content))
+            {
+                spdlog::error("Failed to open tileset file: {}", tileset_path.string());
+                return false;
+            }
+            tileset.source_mtime_ = getFileMtime(tileset_path);
+            tileset.data_ = nlohmann::json::parse(tileset_content, nullptr, false);
+            if (tileset.data_.is_discarded())
+            {
+                spdlog::error("Failed to parse tileset file: {}", tileset_path.string());
+                return false;
+            }
+            tilesets_.push_back(std::move(tileset));
+        }
+        return true;
+    }
+
+    bool LevelBinary::loadBinaryForMap(const std::string &map_path)
+    {
+        if (!isBinaryUpToDate(map_path))
+            return false;
+        if (!loadFromFile(getBinaryPath(map_path)))
+        {
+            spdlog::warn("Failed to load binary level, fall back to map file: {}", map_path);
+            return false;
+        }
+        return areTilesetsUpToDate(map_path);
+    }
+
+    bool LevelBinary::loadForMap(const std::string &map_path)
+    {
+        return loadBinaryForMap(map_path) || loadFromMap(map_path);
+    }
+
+    bool LevelBinary::areTilesetsUpToDate(const std::string &map_path) const
+    {
+        const auto map_dir = std::filesystem::path(map_path).parent_path();
+        for (const auto &tileset : tilesets_)
+        {
+            const auto tileset_path = map_dir / tileset.source_;
+            if (getFileMtime(tileset_path) != tileset.source_mtime_)
+            {
+                spdlog::warn("Tileset changed since binary level was compiled, ignored: {}", tileset_path.string());
+                return false;
+            }
+        }
+        return true;
+    }
+
+    std::string LevelBinary::getBinaryPath(std::string_view map_path)
+    {
+        return std::filesystem::path(map_path).replace_extension(".mwl").string();
+    }
+
+    bool LevelBinary::isBinaryUpToDate(const std::string &map_path)
+    {
+        const auto binary_path = getBinaryPath(map_path);
+        std::error_code ec;
+        if (!std::filesystem::exists(binary_path, ec))
+            return false;
+        // 如果地图文件比二进制关卡更新，说明二进制关卡已过期，需要重新编译
+        if (std::filesystem::exists(map_path, ec) &&
+            std::filesystem::last_write_time(binary_path, ec) < std::filesystem::last_write_time(map_path, ec))
+        {
+            spdlog::warn("Binary level is older than map, ignored: {}", binary_path);
+            return false;
+        }
+        return true;
+    }
+}
@@ -0,0 +1,66 @@
+#pragma once
+#include "tiled_map_parser.h"
+#include <nlohmann/json.hpp>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace engine::loader
+{
+    /**
+     * @brief 预编译的二进制关卡 (.mwl)，由 mw-mapc 从 .tmj + .tsj 生成
+     *
+     * 文件布局（小端序）：
+     * - "MWLV" + 版本号
+     * - 地图头信息 (CBOR，不含 layers/tilesets)
+     * - 图块集数量 + 每个图块集 {firstgid, 相对地图的 source 路径, 编译时 .tsj 的修改时间, .tsj 内容(CBOR)}
+     * - 图层数量 + 每个图层 {图层元数据(CBOR，不含 data), GID 数量, GID 数组}
+     *
+     * 读取时整个文件一次性读入内存，GID 数组直接拷贝，不需要文本解析。
+     */
+    struct LevelBinary
+    {
+        static constexpr uint32_t VERSION = 2; ///< @brief 格式版本，不一致时回退到 .tmj
+
+        /// @brief 内嵌的图块集数据
+        struct Tileset
+        {
+            int first_gid_{0};        ///< @brief 此图块集的第一个全局 ID
+            std::string source_;      ///< @brief .tsj 相对于地图文件的路径（运行时再解析为完整路径）
+            int64_t source_mtime_{0}; ///< @brief 编译时 .tsj 的修改时间，与当前不一致说明内嵌的图块集已过期
+            nlohmann::json data_;     ///< @brief .tsj 内容
+        };
+
+        nlohmann::json header_ = nlohmann::json::object(); ///< @brief 地图头信息（尺寸、瓦片尺寸、背景色等）
+        std::vector<Tileset> tilesets_;                    ///< @brief 图块集列表
+        std::vector<TiledLayer> layers_;                   ///< @brief 图层列表（保持地图中的顺序）
+
+        [[nodiscard]] bool loadFromFile(const std::string &path);     ///< @brief 读取二进制关卡
+        [[nodiscard]] bool saveToFile(const std::string &path) const; ///< @brief 写入二进制关卡
+        [[nodiscard]] bool loadFromMap(const std::string &map_path);  ///< @brief 解析 .tmj 地图并内嵌其引用的 .tsj 图块集
+        /// @brief 内嵌的图块集是否与磁盘上的 .tsj 一致（.tsj 被修改过则返回 false）
+        [[nodiscard]] bool areTilesetsUpToDate(const std::string &map_path) const;
+
+        /**
+         * @brief 读取地图对应的 .mwl，仅当它不旧于 .tmj 且内嵌的图块集与磁盘上的 .tsj 一致时才成功
+         * @note 所有使用二进制关卡的加载路径都应通过此函数，保证过期检查一致
+         * @param map_path 地图文件路径（.tmj）
+         * @return true 成功，false 不存在、已过期或读取失败（调用者应回退到 .tmj）
+         */
+        [[nodiscard]] bool loadBinaryForMap(const std::string &map_path);
+
+        /**
+         * @brief 准备关卡数据：优先读取未过期的 .mwl（loadBinaryForMap），否则解析 .tmj
+         * @note 只涉及文件读取与解析，不访问场景/渲染器，可以在工作线程中调用
+         * @param map_path 地图文件路径（.tmj）
+         * @return true 成功，false 失败
+         */
+        [[nodiscard]] bool loadForMap(const std::string &map_path);
+
+        /// @brief 根据地图路径获取对应的二进制关卡路径 ("assets/maps/level1.tmj" -> "assets/maps/level1.mwl")
+        static std::string getBinaryPath(std::string_view map_path);
+        /// @brief 二进制关卡是否存在且不旧于地图文件（图块集需在读取后由 areTilesetsUpToDate 检查，见 loadBinaryForMap）
+        static bool isBinaryUpToDate(const std::string &map_path);
+    };
+}
@@ -10,7 +10,7 @@
 #include "../utils/math.h"
 #include <filesystem>
 #include <fstream>
-#include <spdlog/spdlog.h>
+#include "../utils/log.h"
 #include <SDL3/SDL_rect.h>
 #include <entt/entity/registry.hpp>
 #include <entt/core/hashed_string.hpp>
@@ -27,61 +27,129 @@ void engine::loader::LevelLoader::setEntityBuilder(std::unique_ptr<BasicEntityBu
 }
 
 bool engine::loader::LevelLoader::loadLevel(const std::string &level_path, engine::scene::Scene *scene)
+{
+    if (!bindScene(scene))
+        return false;
+    map_path_ = level_path;
+
+    // 0. 优先加载预编译的二进制关卡
+    if (loadLevelBinary(level_path))
+    {
+        MW_LOG_INFO(LOADER, "Load binary level successfully: {}", level_path);
+        return true;
+    }
+
+    // 1. 一次性读入文件内容
+    auto path = std::filesystem::path(level_path);
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open())
+    {
+        MW_LOG_ERROR(LOADER, "Failed to open level file: {}", level_path);
+        return false;
+    }
+    std::string content;
+    file.seekg(0, std::ios::end);
+    content.resize(static_cast<size_t>(file.tellg()));
+    file.seekg(0, std::ios::beg);
+    file.read(content.data(), static_cast<std::streamsize>(content.size()));
+
+    // 2. 流式解析：地图头信息完整后加载图块集，图层解析完成即加载（不构建整张地图的 json DOM）
+    TiledMapParser parser([this](const nlohmann::json &map_json)
+                          {
+                              loadMapHeader(map_json);
+                              loadTilesets(map_json); },
+                          [this](TiledLayer &layer)
+                          { loadLayer(layer); });
+    if (!parser.parse(content))
+    {
+        MW_LOG_ERROR(LOADER, "Failed to parse level file JSON: {}", parser.getError());
+        return false;
+    }
+    if (!parser.hasLayers())
+    { // 地图文件中必须有 layers 数组
+        MW_LOG_ERROR(LOADER, "map not has layers: {}", level_path);
+        return false;
+    }
+
+    MW_LOG_INFO(LOADER, "Load level successfully: {}", level_path);
+    return true;
+}
+
+bool engine::loader::LevelLoader::loadLevel(LevelBinary level, const std::string &level_path, engine::scene::Scene *scene)
+{
+    if (!bindScene(scene))
+        return false;
+    map_path_ = level_path;
+
+    buildLevel(level);
+    MW_LOG_INFO(LOADER, "Load preloaded level successfully: {}", level_path);
+    return true;
+}
+
+bool engine::loader::LevelLoader::bindScene(engine::scene::Scene *scene)
 {
     if (!scene)
     {
-        spdlog::error("Scene is null");
+        MW_LOG_ERROR(LOADER, "Scene is null");
         return false;
     }
     scene_ = scene;
 
     if (!entity_builder_)
     {
-        spdlog::info("Create entity builder");
+        MW_LOG_INFO(LOADER, "Create entity builder");
         entity_builder_ = std::make_unique<BasicEntityBuilder>(*this, scene->getContext(), scene->getRegistry());
     }
+    return true;
+}
 
-    // 1. 加载 JSON 文件
-    auto path = std::filesystem::path(level_path);
-    std::ifstream file(path);
-    if (!file.is_open())
-    {
-        spdlog::error("Failed to open level file: {}", level_path);
+bool engine::loader::LevelLoader::loadLevelBinary(const std::string &level_path)
+{
+    // 先完整读取并校验（包括 .mwl 与内嵌图块集是否过期），全部成功后才开始创建实体，保证失败时可以安全回退
+    LevelBinary level;
+    if (!level.loadBinaryForMap(level_path))
         return false;
-    }
 
-    // 2. 解析 JSON 数据
-    nlohmann::json json_data;
-    try
+    buildLevel(level);
+    return true;
+}
+
+void engine::loader::LevelLoader::buildLevel(LevelBinary &level)
+{
+    loadMapHeader(level.header_);
+    for (auto &tileset : level.tilesets_)
     {
-        file >> json_data;
+        addTileset(std::move(tileset.data_), resolvePath(tileset.source_, map_path_), tileset.first_gid_);
     }
-    catch (const nlohmann::json::parse_error &e)
+    for (const auto &layer : level.layers_)
     {
-        spdlog::error("Failed to parse level file JSON: {}", e.what());
-        return false;
+        loadLayer(layer);
     }
+}
 
-    // 3. 获取基本地图信息 (名称、地图尺寸、瓦片尺寸)
-    map_path_ = level_path;
-    map_size_ = glm::ivec2(json_data.value("width", 0), json_data.value("height", 0));
-    tile_size_ = glm::ivec2(json_data.value("tilewidth", 0), json_data.value("tileheight", 0));
-    if (json_data.contains("backgroundcolor"))
+void engine::loader::LevelLoader::loadMapHeader(const nlohmann::json &map_json)
+{
+    // 获取基本地图信息 (地图尺寸、瓦片尺寸、背景色)
+    map_size_ = glm::ivec2(map_json.value("width", 0), map_json.value("height", 0));
+    tile_size_ = glm::ivec2(map_json.value("tilewidth", 0), map_json.value("tileheight", 0));
+    if (map_json.contains("backgroundcolor"))
     {
-        auto color_string = json_data["backgroundcolor"].get<std::string>();
+        auto color_string = map_json["backgroundcolor"].get<std::string>();
         auto color = engine::utils::parseHexColor(color_string);
         scene_->getContext().getRender().setBgColorFloat(color.r, color.g, color.b, color.a);
     }
+}
 
-    // 4. 加载 tileset 数据
-    if (json_data.contains("tilesets") && json_data["tilesets"].is_array())
+void engine::loader::LevelLoader::loadTilesets(const nlohmann::json &map_json)
+{
+    if (map_json.contains("tilesets") && map_json["tilesets"].is_array())
     {
-        for (const auto &tileset_json : json_data["tilesets"])
+        for (const auto &tileset_json : map_json["tilesets"])
         {
             if (!tileset_json.contains("source") || !tileset_json["source"].is_string() ||
                 !tileset_json.contains("firstgid") || !tileset_json["firstgid"].is_number_integer())
             {
-                spdlog::error("tilesets not has source or firstgid。");
+                MW_LOG_ERROR(LOADER, "tilesets not has source or firstgid。");
                 continue;
             }
             auto tileset_path = resolvePath(tileset_json["source"].get<std::string>(), map_path_); // 支持隐式转换，可以省略.get<T>()方法，
@@ -89,58 +157,50 @@ bool engine::loader::LevelLoader::loadLevel(const std::string &level_path, engin
             loadTileset(tileset_path, first_gid);
         }
     }
+}
 
-    // 5. 加载图层数据
-    if (!json_data.contains("layers") || !json_data["layers"].is_array())
-    { // 地图文件中必须有 layers 数组
-        spdlog::error("map not has layers: {}", level_path);
-        return false;
-    }
-    for (const auto &layer_json : json_data["layers"])
+void engine::loader::LevelLoader::loadLayer(const TiledLayer &layer)
+{
+    const auto &layer_json = layer.meta_;
+    // 获取各图层对象中的类型（type）字段
+    std::string layer_type = layer_json.value("type", "none");
+    if (!layer_json.value("visible", true))
     {
-        // 获取各图层对象中的类型（type）字段
-        std::string layer_type = layer_json.value("type", "none");
-        if (!layer_json.value("visible", true))
-        {
-            spdlog::info("layer not visible: {}", layer_json.value("name", "Unnamed"));
-            continue;
-        }
+        MW_LOG_INFO(LOADER, "layer not visible: {}", layer_json.value("name", "Unnamed"));
+        return;
+    }
 
-        if (layer_json.contains("properties"))
+    if (layer_json.contains("properties"))
+    {
+        auto &properties = layer_json["properties"];
+        for (auto &property : properties)
         {
-            auto &properties = layer_json["properties"];
-            for (auto &property : properties)
+            if (property.contains("name") && property["name"] == "order")
             {
-                if (property.contains("name") && property["name"] == "order")
-                {
-                    current_layer_ = property["value"].get<int>();
-                }
+                current_layer_ = property["value"].get<int>();
             }
         }
-
-        // 根据图层类型决定加载方法
-        if (layer_type == "imagelayer")
-        {
-            loadImageLayer(layer_json);
-        }
-        else if (layer_type == "tilelayer")
-        {
-            loadTileLayer(layer_json);
-        }
-        else if (layer_type == "objectgroup")
-        {
-            loadObjectLayer(layer_json);
-        }
-        else
-        {
-            spdlog::warn("Unsupported layer type: {}", layer_type);
-        }
-        spdlog::info("Load layer: {}, current layer: {}", layer_json.value("name", "Unnamed"), current_layer_);
-        current_layer_++;
     }
 
-    spdlog::info("Load level successfully: {}", level_path);
-    return true;
+    // 根据图层类型决定加载方法
+    if (layer_type == "imagelayer")
+    {
+        loadImageLayer(layer_json);
+    }
+    else if (layer_type == "tilelayer")
+    {
+        loadTileLayer(layer_json, layer.gids_);
+    }
+    else if (layer_type == "objectgroup")
+    {
+        loadObjectLayer(layer_json);
+    }
+    else
+    {
+        MW_LOG_WARN(LOADER, "Unsupported layer type: {}", layer_type);
+    }
+    MW_LOG_INFO(LOADER, "Load layer: {}, current layer: {}", layer_json.value("name", "Unnamed"), current_layer_);
+    current_layer_++;
 }
 
 void engine::loader::LevelLoader::loadImageLayer(const nlohmann::json &layer_json)
@@ -150,7 +210,7 @@ void engine::loader::LevelLoader::loadImageLayer(const nlohmann::json &layer_jso
                                                             // 不能用std::string_view
     if (image_path.empty())
     {
-        spdlog::error("Image layer not has image: {}", layer_json.value("name", "Unnamed"));
+        MW_LOG_ERROR(LOADER, "Image layer not has image: {}", layer_json.value("name", "Unnamed"));
         return;
     }
 
@@ -183,14 +243,14 @@ void engine::loader::LevelLoader::loadImageLayer(const nlohmann::json &layer_jso
     registry.emplace<engine::component::RenderComponent>(entity, current_layer_);
     /* 实体与组件创建完毕后即由registry自动管理， */
 
-    spdlog::info("Load image layer successfully: {}", layer_name);
+    MW_LOG_INFO(LOADER, "Load image layer successfully: {}", layer_name);
 }
 
-void engine::loader::LevelLoader::loadTileLayer(const nlohmann::json &layer_json)
+void engine::loader::LevelLoader::loadTileLayer(const nlohmann::json &layer_json, const std::vector<uint32_t> &gids)
 {
-    if (!layer_json.contains("data") || !layer_json["data"].is_array())
+    if (gids.empty())
     {
-        spdlog::error("Tile layer not has data: {}", layer_json.value("name", "Unnamed"));
+        MW_LOG_ERROR(LOADER, "Tile layer not has data: {}", layer_json.value("name", "Unnamed"));
         return;
     }
 
@@ -207,13 +267,11 @@ void engine::loader::LevelLoader::loadTileLayer(const nlohmann::json &layer_json
     std::vector<entt::entity> tiles;
     tiles.reserve(map_size_.x * map_size_.y);
 
-    // 获取图层数据 (瓦片 ID 列表)
-    const auto &data = layer_json["data"];
-
     size_t index = 0; // data数据的索引，它决定图块在地图中的位置
     // --- 每一个瓦片都是一个独立的entity ---
-    for (const int gid : data)
+    for (const uint32_t raw_gid : gids)
     {
+        const int gid = static_cast<int>(raw_gid); // 保留最高位的翻转标志，由getTileInfoByGid处理
         if (gid == 0)
         {
             index++;
@@ -222,7 +280,7 @@ void engine::loader::LevelLoader::loadTileLayer(const nlohmann::json &layer_json
         auto tile_info = getTileInfoByGid(gid);
         if (!tile_info)
         {
-            spdlog::error("Tile not found for gid: {}", gid);
+            MW_LOG_ERROR(LOADER, "Tile not found for gid: {}", gid);
             index++;
             continue;
         }
@@ -236,14 +294,14 @@ void engine::loader::LevelLoader::loadTileLayer(const nlohmann::json &layer_json
     // 最后将瓦片层组件添加到图层实体中
     registry.emplace<engine::component::TileLayerComponent>(layer_entity, tile_size_, map_size_, tiles);
 
-    spdlog::info("Load tile layer successfully: {}", layer_name);
+    MW_LOG_INFO(LOADER, "Load tile layer successfully: {}", layer_name);
 }
 
 void engine::loader::LevelLoader::loadObjectLayer(const nlohmann::json &layer_json)
 {
     if (!layer_json.contains("objects") || !layer_json["objects"].is_array())
     {
-        spdlog::error("Object layer not has objects: {}", layer_json.value("name", "Unnamed"));
+        MW_LOG_ERROR(LOADER, "Object layer not has objects: {}", layer_json.value("name", "Unnamed"));
         return;
     }
     // 获取对象数据
@@ -264,7 +322,7 @@ void engine::loader::LevelLoader::loadObjectLayer(const nlohmann::json &layer_js
             auto tile_info = getTileInfoByGid(gid);
             if (!tile_info)
             {
-                spdlog::warn("Tile not found for gid: {}", layer_json.value("name", "Unnamed"));
+                MW_LOG_WARN(LOADER, "Tile not found for gid: {}", layer_json.value("name", "Unnamed"));
                 continue;
             }
             // 配置生成器，并调用build，针对图片对象
@@ -279,7 +337,7 @@ void engine::loader::LevelLoader::loadTileset(const std::string &tileset_path, i
     std::ifstream tileset_file(path);
     if (!tileset_file.is_open())
     {
-        spdlog::error("Failed to open tileset file: {}", tileset_path);
+        MW_LOG_ERROR(LOADER, "Failed to open tileset file: {}", tileset_path);
         return;
     }
 
@@ -290,12 +348,17 @@ void engine::loader::LevelLoader::loadTileset(const std::string &tileset_path, i
     }
     catch (const nlohmann::json::parse_error &e)
     {
-        spdlog::error("Failed to parse tileset file: {}, error: {}, byte: {}", tileset_path, e.what(), e.byte);
+        MW_LOG_ERROR(LOADER, "Failed to parse tileset file: {}, error: {}, byte: {}", tileset_path, e.what(), e.byte);
         return;
     }
-    ts_json["file_path"] = tileset_path; // 将文件路径存储到json中，后续解析图片路径时需要
-    tileset_data_[first_gid] = std::move(ts_json);
-    spdlog::info("Load tileset: {}, first_gid: {}", tileset_path, first_gid);
+    addTileset(std::move(ts_json), tileset_path, first_gid);
+}
+
+void engine::loader::LevelLoader::addTileset(nlohmann::json tileset_json, const std::string &tileset_path, int first_gid)
+{
+    tileset_json["file_path"] = tileset_path; // 将文件路径存储到json中，后续解析图片路径时需要
+    tileset_data_[first_gid] = std::move(tileset_json);
+    MW_LOG_INFO(LOADER, "Load tileset: {}, first_gid: {}", tileset_path, first_gid);
 }
 
 std::optional<engine::utils::Rect> engine::loader::LevelLoader::getColliderRect(const nlohmann::json &tile_json)
@@ -381,7 +444,7 @@ std::optional<engine::component::TileInfo> engine::loader::LevelLoader::getTileI
     auto tileset_it = tileset_data_.upper_bound(gid);
     if (tileset_it == tileset_data_.begin())
     {
-        spdlog::error("Tileset not found for gid: {}", gid);
+        MW_LOG_ERROR(LOADER, "Tileset not found for gid: {}", gid);
         return std::nullopt;
     }
     --tileset_it; // 前移一个位置，这样就得到不大于gid的最近一个元素（我们需要的）
@@ -391,7 +454,7 @@ std::optional<engine::component::TileInfo> engine::loader::LevelLoader::getTileI
     std::string file_path = tileset.value("file_path", ""); // 获取图块集文件路径
     if (file_path.empty())
     {
-        spdlog::error("Tileset file path not found for gid: {}", tileset_it->first);
+        MW_LOG_ERROR(LOADER, "Tileset file path not found for gid: {}", tileset_it->first);
         return std::nullopt;
     }
 
@@ -413,7 +476,7 @@ std::optional<engine::component::TileInfo> engine::loader::LevelLoader::getTileI
     // --- 考虑多图片的情况 ---
     if (!is_single_image && !tileset.contains("tiles"))
     { // 没有tiles字段的话不符合数据格式要求，直接返回空的瓦片信息
-        spdlog::error("Tileset File '{}' not has 'tiles' property", tileset_it->first);
+        MW_LOG_ERROR(LOADER, "Tileset File '{}' not has 'tiles' property", tileset_it->first);
         return std::nullopt;
     }
     // 遍历tiles数组，根据id查找对应的瓦片
@@ -428,7 +491,7 @@ std::optional<engine::component::TileInfo> engine::loader::LevelLoader::getTileI
             {
                 if (!tile_json.contains("image"))
                 { // 没有image字段的话不符合数据格式要求，直接返回空的瓦片信息
-                    spdlog::error("Tileset 文件 '{}' 中瓦片 {} 缺少 'image' 属性。", tileset_it->first, tile_id);
+                    MW_LOG_ERROR(LOADER, "Tileset 文件 '{}' 中瓦片 {} 缺少 'image' 属性。", tileset_it->first, tile_id);
                     return std::nullopt;
                 }
                 // --- 接下来根据必要信息创建并返回 TileInfo ---
@@ -448,19 +511,30 @@ std::optional<engine::component::TileInfo> engine::loader::LevelLoader::getTileI
             // 补充动画信息 （瓦片动画为animation字段，且必须为数组，目前只考虑单一图片情况）
             if (tile_json.contains("animation") && is_single_image && tile_json["animation"].is_array())
             {
-                std::vector<engine::component::AnimationFrame> animation_frames;
-                auto &animation = tile_json["animation"];
-                for (auto &frame : animation)
+                // 同一图块的动画只编译一次，所有使用该图块的实体共享
+                if (auto clip_set_it = tile_clip_sets_.find(gid); clip_set_it != tile_clip_sets_.end())
+                {
+                    tile_info.animation_ = clip_set_it->second;
+                }
+                else
                 {
-                    // 每个瓦片动画帧json有两个信息：tileid 和 duration
-                    float duration_ms = frame.value("duration", 100.0f);
-                    int id = frame.value("tileid", 0);
-                    auto frame_rect = getTextureRect(tileset, id); // 根据id获取纹理源矩形
-                    // 源矩形 + 时长，组成一个动画帧
-                    auto animation_frame = engine::component::AnimationFrame(frame_rect, duration_ms);
-                    animation_frames.push_back(animation_frame);
+                    std::vector<engine::component::AnimationFrame> animation_frames;
+                    auto &animation = tile_json["animation"];
+                    for (auto &frame : animation)
+                    {
+                        // 每个瓦片动画帧json有两个信息：tileid 和 duration
+                        float duration_ms = frame.value("duration", 100.0f);
+                        int id = frame.value("tileid", 0);
+                        auto frame_rect = getTextureRect(tileset, id); // 根据id获取纹理源矩形
+                        // 源矩形 + 时长，组成一个动画帧
+                        auto animation_frame = engine::component::AnimationFrame(frame_rect, duration_ms);
+                        animation_frames.push_back(animation_frame);
+                    }
+                    auto clip_set = std::make_shared<engine::component::AnimationClipSet>();
+                    clip_set->addClip(entt::hashed_string("tile"), engine::component::Animation(std::move(animation_frames))); // 图块动画名称默认为"tile"
+                    tile_clip_sets_.emplace(gid, clip_set);
+                    tile_info.animation_ = std::move(clip_set);
                 }
-                tile_info.animation_ = engine::component::Animation(std::move(animation_frames));
             }
             // 补充属性信息
             if (tile_json.contains("properties"))
@@ -486,7 +560,7 @@ std::string engine::loader::LevelLoader::resolvePath(const std::string &relative
     }
     catch (const std::exception &e)
     {
-        spdlog::error("解析路径失败: {}", e.what());
+        MW_LOG_ERROR(LOADER, "解析路径失败: {}", e.what());
         return std::string(relative_path);
     }
 }
@@ -1,6 +1,8 @@
 #pragma once
 #include "../utils/math.h"
 #include "basic_entity_builder.h"
+#include "tiled_map_parser.h"
+#include "level_binary.h"
 #include <string>
 #include <string_view>
 #include <memory>
@@ -10,11 +12,13 @@
 #include <entt/entity/registry.hpp>
 #include <SDL3/SDL_rect.h>
 #include <map>
+#include <unordered_map>
 
 namespace engine::component
 {
     enum class TileType;
     struct TileInfo;
+    class AnimationClipSet;
 }
 
 namespace engine::scene
@@ -39,6 +43,7 @@ namespace engine::loader
         glm::ivec2 tile_size_; ///< @brief 瓦片尺寸(像素)
 
         std::map<int, nlohmann::json> tileset_data_; ///< @brief firstgid -> 瓦片集数据
+        std::unordered_map<int, std::shared_ptr<const engine::component::AnimationClipSet>> tile_clip_sets_; ///< @brief gid -> 已编译的图块动画（同一图块的实体共享）
 
         std::unique_ptr<BasicEntityBuilder> entity_builder_; ///< @brief 实体生成器(生成器模式)
 
@@ -52,12 +57,22 @@ namespace engine::loader
 
         /**
          * @brief 加载关卡数据，并生成游戏实体
+         * @note 如果同目录下存在不旧于 .tmj 的预编译关卡 (.mwl)，则优先加载它
          * @param level_path 关卡文件路径（.tmj）
          * @param scene 场景指针（非拥有）
          * @return true 加载成功，false 加载失败
          */
         [[nodiscard]] bool loadLevel(const std::string &level_path, engine::scene::Scene *scene);
 
+        /**
+         * @brief 使用已准备好的关卡数据（如 LevelPreloader 在后台线程解析的结果）生成游戏实体
+         * @param level 关卡数据（图块集、图层）
+         * @param level_path 关卡文件路径（.tmj，解析相对路径时需要）
+         * @param scene 场景指针（非拥有）
+         * @return true 加载成功，false 加载失败
+         */
+        [[nodiscard]] bool loadLevel(LevelBinary level, const std::string &level_path, engine::scene::Scene *scene);
+
         // --- getters and setters ---
         const glm::ivec2 &getMapSize() const { return map_size_; }
         const glm::ivec2 &getTileSize() const { return tile_size_; }
@@ -65,9 +80,16 @@ namespace engine::loader
         int getCurrentLayer() const { return current_layer_; }
 
     private:
-        void loadImageLayer(const nlohmann::json &layer_json);  ///< @brief 加载图片图层
-        void loadTileLayer(const nlohmann::json &layer_json);   ///< @brief 加载瓦片图层
-        void loadObjectLayer(const nlohmann::json &layer_json); ///< @brief 加载对象图层
+        [[nodiscard]] bool bindScene(engine::scene::Scene *scene);         ///< @brief 绑定场景，未设置实体生成器时创建默认生成器
+        [[nodiscard]] bool loadLevelBinary(const std::string &level_path); ///< @brief 尝试加载预编译关卡，失败时返回false（回退到.tmj）
+        void buildLevel(LevelBinary &level);                               ///< @brief 根据完整的关卡数据加载图块集并生成图层实体
+        void loadMapHeader(const nlohmann::json &map_json);                ///< @brief 加载地图头信息（尺寸、背景色）
+        void loadTilesets(const nlohmann::json &map_json);                 ///< @brief 加载地图引用的所有图块集
+        void loadLayer(const TiledLayer &layer);                           ///< @brief 根据图层类型分派加载
+
+        void loadImageLayer(const nlohmann::json &layer_json);                                    ///< @brief 加载图片图层
+        void loadTileLayer(const nlohmann::json &layer_json, const std::vector<uint32_t> &gids); ///< @brief 加载瓦片图层
+        void loadObjectLayer(const nlohmann::json &layer_json);                                   ///< @brief 加载对象图层
 
         /**
          * @brief 加载 Tiled tileset 文件 (.tsj)，数据保存到tileset_data_。
@@ -76,6 +98,14 @@ namespace engine::loader
          */
         void loadTileset(const std::string &tileset_path, int first_gid);
 
+        /**
+         * @brief 添加已解析的图块集数据到tileset_data_
+         * @param tileset_json 图块集数据
+         * @param tileset_path 图块集文件路径（解析图片路径时需要）
+         * @param first_gid 此 tileset 的第一个全局 ID。
+         */
+        void addTileset(nlohmann::json tileset_json, const std::string &tileset_path, int first_gid);
+
         /**
          * @brief 获取瓦片属性
          * @tparam T 属性类型
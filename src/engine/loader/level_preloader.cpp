@@ -0,0 +1,49 @@
+#include "level_preloader.h"
+#include "../utils/log.h"
+
+namespace engine::loader
+{
+    LevelPreloader::~LevelPreloader()
+    {
+        // std::async 返回的future在析构时会等待工作线程结束，这里显式等待，保证不会在线程运行中途释放数据
+        if (future_.valid())
+        {
+            future_.wait();
+        }
+    }
+
+    void LevelPreloader::request(const std::string &map_path)
+    {
+        if (future_.valid() && map_path_ == map_path)
+            return;
+        if (future_.valid())
+        {
+            future_.wait(); // 丢弃之前的预加载结果
+        }
+
+        map_path_ = map_path;
+        MW_LOG_INFO(LOADER, "Preloading level in background: {}", map_path);
+        future_ = std::async(std::launch::async, [map_path]() -> std::optional<LevelBinary>
+                             {
+                                 LevelBinary level;
+                                 if (!level.loadForMap(map_path))
+                                 {
+                                     MW_LOG_WARN(LOADER, "Failed to preload level: {}", map_path);
+                                     return std::nullopt;
+                                 }
+                                 return level; });
+    }
+
+    std::optional<LevelBinary> LevelPreloader::take(const std::string &map_path)
+    {
+        if (!future_.valid() || map_path_ != map_path)
+            return std::nullopt;
+        if (future_.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        {
+            MW_LOG_INFO(LOADER, "Waiting for level preloading to finish: {}", map_path);
+        }
+        auto result = future_.get(); // get()之后future_不再有效
+        map_path_.clear();
+        return result;
+    }
+}
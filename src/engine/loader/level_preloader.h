@@ -0,0 +1,43 @@
+#pragma once
+#include "level_binary.h"
+#include <future>
+#include <optional>
+#include <string>
+
+namespace engine::loader
+{
+    /**
+     * @brief 关卡预加载器，在工作线程中读取并解析下一关的地图数据
+     *
+     * 例如在通关结算界面显示期间调用request()开始解析，切换到下一关时调用take()取出结果，
+     * 主线程只需要完成最后的实体创建（LevelLoader::loadLevel 的 LevelBinary 重载）。
+     * @note 工作线程只进行文件读取与解析，纹理等渲染资源仍在主线程创建实体时加载（SDL渲染器不是线程安全的）
+     */
+    class LevelPreloader final
+    {
+        std::string map_path_;                           ///< @brief 正在（或已经）预加载的地图路径
+        std::future<std::optional<LevelBinary>> future_; ///< @brief 工作线程的解析结果
+
+    public:
+        LevelPreloader() = default;
+        ~LevelPreloader();
+        LevelPreloader(const LevelPreloader &) = delete;
+        LevelPreloader &operator=(const LevelPreloader &) = delete;
+
+        /**
+         * @brief 开始在工作线程中预加载地图（同一路径重复请求会被忽略）
+         * @param map_path 地图文件路径（.tmj）
+         */
+        void request(const std::string &map_path);
+
+        /**
+         * @brief 取出预加载结果（如果工作线程尚未完成，则等待其完成）
+         * @param map_path 地图文件路径，与请求的路径不一致时返回std::nullopt
+         * @return 关卡数据，未请求、路径不一致或解析失败时返回std::nullopt
+         */
+        [[nodiscard]] std::optional<LevelBinary> take(const std::string &map_path);
+
+        /// @brief 是否有尚未取出的预加载任务
+        bool isPending() const { return future_.valid(); }
+    };
+}
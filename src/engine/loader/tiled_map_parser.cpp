@@ -0,0 +1,435 @@
+#include "tiled_map_parser.h"
+#include <spdlog/spdlog.h>
+#include <array>
+#include <utility>
+#ifdef MW_HAS_ZLIB
+#include <zlib.h>
+#endif
+#ifdef MW_HAS_ZSTD
+#include <zstd.h>
+#endif
+
+namespace engine::loader
+{
+    namespace
+    {
+        /**
+         * @brief SAX 事件处理器
+         *
+         * 除图层 data 外，其余内容仍按 DOM 方式构建（头信息、图层元数据、对象等数据量都很小）。
+         * 层级约定：根对象深度为1，layers 数组为2，顶层图层对象为3，图层 data 数组为4。
+         */
+        class TiledSaxHandler
+        {
+            using json = nlohmann::json;
+
+            TiledMapParser::HeaderCallback &on_header_;
+            TiledMapParser::LayerCallback &on_layer_;
+
+            json header_ = json::object();     ///< @brief 地图头信息 (根对象中除 layers 外的所有字段)
+            std::vector<json *> ref_stack_;    ///< @brief 正在构建的 json 容器栈
+            json *object_element_{nullptr};    ///< @brief 当前 key 对应的待赋值元素
+            int depth_{0};                     ///< @brief 当前嵌套深度
+
+            bool expect_layers_{false};        ///< @brief 刚读到根对象的 "layers" 键
+            bool in_layers_{false};            ///< @brief 位于根 layers 数组中
+            bool in_layer_{false};             ///< @brief 位于顶层图层对象中
+            bool expect_data_{false};          ///< @brief 刚读到图层的 "data" 键
+            bool in_data_array_{false};        ///< @brief 位于图层 data 数组中
+            bool header_ready_{false};         ///< @brief 头信息是否已派发
+
+            TiledLayer current_;                      ///< @brief 正在解析的图层
+            std::string encoded_data_;                ///< @brief 编码后的图层 data (base64)
+            std::vector<TiledLayer> pending_layers_;  ///< @brief 头信息完整前缓存的图层
+            size_t data_size_hint_{0};                ///< @brief 上一个图层的瓦片数量，用于预分配
+
+        public:
+            std::string error_;
+            bool has_layers_{false};
+
+            TiledSaxHandler(TiledMapParser::HeaderCallback &on_header, TiledMapParser::LayerCallback &on_layer)
+                : on_header_(on_header), on_layer_(on_layer) {}
+
+            // --- nlohmann SAX 接口 ---
+            bool null() { return addScalar(nullptr); }
+            bool boolean(bool val) { return addScalar(val); }
+            bool number_integer(json::number_integer_t val)
+            {
+                if (in_data_array_)
+                {
+                    current_.gids_.push_back(static_cast<uint32_t>(val));
+                    return true;
+                }
+                return addScalar(val);
+            }
+            bool number_unsigned(json::number_unsigned_t val)
+            {
+                if (in_data_array_)
+                {
+                    current_.gids_.push_back(static_cast<uint32_t>(val));
+                    return true;
+                }
+                return addScalar(val);
+            }
+            bool number_float(json::number_float_t val, const json::string_t &)
+            {
+                return addScalar(val);
+            }
+            bool string(json::string_t &val)
+            {
+                if (expect_data_)
+                { // base64 编码的图层数据，待图层结束后 (拿到 encoding/compression/尺寸) 再解码
+                    expect_data_ = false;
+                    encoded_data_ = std::move(val);
+                    return true;
+                }
+                return addScalar(std::move(val));
+            }
+            bool binary(json::binary_t &val) { return addScalar(std::move(val)); }
+
+            bool start_object(std::size_t)
+            {
+                ++depth_;
+                if (depth_ == 1)
+                {
+                    ref_stack_.push_back(&header_);
+                    return true;
+                }
+                if (in_layers_ && !in_layer_ && depth_ == 3)
+                { // 新的顶层图层
+                    in_layer_ = true;
+                    current_ = TiledLayer{json::object(), {}};
+                    ref_stack_.push_back(&current_.meta_);
+                    return true;
+                }
+                auto *value = addValue(json::object());
+                if (!value)
+                    return false;
+                ref_stack_.push_back(value);
+                return true;
+            }
+
+            bool key(json::string_t &val)
+            {
+                if (depth_ == 1 && val == "layers")
+                {
+                    expect_layers_ = true;
+                    has_layers_ = true;
+                    return true;
+                }
+                if (in_layer_ && depth_ == 3 && val == "data")
+                {
+                    expect_data_ = true;
+                    return true;
+                }
+                object_element_ = &(*ref_stack_.back())[val];
+                return true;
+            }
+
+            bool end_object()
+            {
+                ref_stack_.pop_back();
+                --depth_;
+                if (in_layer_ && depth_ == 2)
+                {
+                    in_layer_ = false;
+                    finishLayer();
+                }
+                else if (depth_ == 1)
+                {
+                    checkHeaderReady();
+                }
+                else if (depth_ == 0)
+                { // 根对象结束，头信息不论完整与否都要派发，并清空缓存的图层
+                    dispatchHeader();
+                }
+                return true;
+            }
+
+            bool start_array(std::size_t)
+            {
+                ++depth_;
+                if (depth_ == 1)
+                {
+                    error_ = "map root must be an object";
+                    return false;
+                }
+                if (expect_layers_ && depth_ == 2)
+                {
+                    expect_layers_ = false;
+                    in_layers_ = true;
+                    return true;
+                }
+                if (expect_data_ && depth_ == 4)
+                {
+                    expect_data_ = false;
+                    in_data_array_ = true;
+                    current_.gids_.reserve(data_size_hint_);
+                    return true;
+                }
+                auto *value = addValue(json::array());
+                if (!value)
+                    return false;
+                ref_stack_.push_back(value);
+                return true;
+            }
+
+            bool end_array()
+            {
+                --depth_;
+                if (in_data_array_ && depth_ == 3)
+                {
+                    in_data_array_ = false;
+                    return true;
+                }
+                if (in_layers_ && depth_ == 1)
+                {
+                    in_layers_ = false;
+                    checkHeaderReady();
+                    return true;
+                }
+                ref_stack_.pop_back();
+                if (depth_ == 1)
+                    checkHeaderReady();
+                return true;
+            }
+
+            bool parse_error(std::size_t position, const std::string &, const json::exception &ex)
+            {
+                error_ = std::string(ex.what()) + " (byte: " + std::to_string(position) + ")";
+                return false;
+            }
+
+        private:
+            /// @brief 将一个值挂到当前容器上，返回其地址；结构不合法时返回nullptr
+            json *addValue(json &&value)
+            {
+                if (expect_layers_ || expect_data_ || in_data_array_ || (in_layers_ && !in_layer_ && depth_ <= 3))
+                {
+                    error_ = "unexpected value in layers/data";
+                    return nullptr;
+                }
+                if (ref_stack_.empty())
+                {
+                    error_ = "map root must be an object";
+                    return nullptr;
+                }
+                auto *container = ref_stack_.back();
+                if (container->is_array())
+                {
+                    container->push_back(std::move(value));
+                    return &container->back();
+                }
+                *object_element_ = std::move(value);
+                return object_element_;
+            }
+
+            template <typename T>
+            bool addScalar(T &&val)
+            {
+                if (!addValue(json(std::forward<T>(val))))
+                    return false;
+                if (depth_ == 1)
+                    checkHeaderReady();
+                return true;
+            }
+
+            void finishLayer()
+            {
+                if (!encoded_data_.empty())
+                {
+                    auto tile_count = static_cast<size_t>(current_.meta_.value("width", 0)) * current_.meta_.value("height", 0);
+                    if (!TiledMapParser::decodeLayerData(encoded_data_,
+                                                         current_.meta_.value("encoding", ""),
+                                                         current_.meta_.value("compression", ""),
+                                                         tile_count,
+                                                         current_.gids_))
+                    {
+                        spdlog::error("Failed to decode layer data: {}", current_.meta_.value("name", "Unnamed"));
+                        current_.gids_.clear();
+                    }
+                    encoded_data_.clear();
+                }
+                data_size_hint_ = std::max(data_size_hint_, current_.gids_.size());
+
+                if (header_ready_)
+                {
+                    on_layer_(current_);
+                }
+                else
+                {
+                    pending_layers_.push_back(std::move(current_));
+                }
+                current_ = TiledLayer{};
+            }
+
+            /// @brief 根对象的某个字段完成后调用，头信息完整时立即派发
+            void checkHeaderReady()
+            {
+                if (header_ready_)
+                    return;
+                if (header_.contains("width") && header_.contains("height") &&
+                    header_.contains("tilewidth") && header_.contains("tileheight") &&
+                    header_.contains("tilesets"))
+                {
+                    dispatchHeader();
+                }
+            }
+
+            void dispatchHeader()
+            {
+                if (header_ready_)
+                    return;
+                header_ready_ = true;
+                on_header_(header_);
+                for (auto &layer : pending_layers_)
+                {
+                    on_layer_(layer);
+                }
+                pending_layers_.clear();
+            }
+        };
+
+        /// @brief base64 解码
+        bool decodeBase64(std::string_view input, std::string &out)
+        {
+            static constexpr auto TABLE = []
+            {
+                std::array<int8_t, 256> table{};
+                table.fill(-1);
+                constexpr std::string_view chars = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+                for (size_t i = 0; i < chars.size(); ++i)
+                {
+                    table[static_cast<unsigned char>(chars[i])] = static_cast<int8_t>(i);
+                }
+                return table;
+            }();
+
+            out.clear();
+            out.reserve(input.size() / 4 * 3);
+            uint32_t buffer = 0;
+            int bits = 0;
+            for (const char c : input)
+            {
+                if (c == '=')
+                    break;
+                if (c == ' ' || c == '\n' || c == '\r' || c == '\t')
+                    continue; // Tiled 可能在长字符串中换行
+                const auto value = TABLE[static_cast<unsigned char>(c)];
+                if (value < 0)
+                    return false;
+                buffer = (buffer << 6) | static_cast<uint32_t>(value);
+                bits += 6;
+                if (bits >= 8)
+                {
+                    bits -= 8;
+                    out.push_back(static_cast<char>((buffer >> bits) & 0xFF));
+                }
+            }
+            return true;
+        }
+
+        /// @brief 解压缩图层数据，expected_size 为解压后的字节数
+        bool decompress(std::string_view compression, [[maybe_unused]] const std::string &input, [[maybe_unused]] size_t expected_size, [[maybe_unused]] std::string &out)
+        {
+            if (compression == "zlib" || compression == "gzip")
+            {
+#ifdef MW_HAS_ZLIB
+                out.resize(expected_size);
+                z_stream stream{};
+                stream.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(input.data()));
+                stream.avail_in = static_cast<uInt>(input.size());
+                stream.next_out = reinterpret_cast<Bytef *>(out.data());
+                stream.avail_out = static_cast<uInt>(out.size());
+                // windowBits = 15 + 32：自动识别 zlib 与 gzip 头
+                if (inflateInit2(&stream, 15 + 32) != Z_OK)
+                    return false;
+                const auto result = inflate(&stream, Z_FINISH);
+                out.resize(stream.total_out);
+                inflateEnd(&stream);
+                return result == Z_STREAM_END;
+#else
+                spdlog::error("Layer compression '{}' not supported by this build (zlib not found)", compression);
+                return false;
+#endif
+            }
+            if (compression == "zstd")
+            {
+#ifdef MW_HAS_ZSTD
+                out.resize(expected_size);
+                const auto result = ZSTD_decompress(out.data(), out.size(), input.data(), input.size());
+                if (ZSTD_isError(result))
+                {
+                    spdlog::error("zstd decompress failed: {}", ZSTD_getErrorName(result));
+                    return false;
+                }
+                out.resize(result);
+                return true;
+#else
+                spdlog::error("Layer compression '{}' not supported by this build (zstd not found)", compression);
+                return false;
+#endif
+            }
+            spdlog::error("Unknown layer compression: {}", compression);
+            return false;
+        }
+    }
+
+    TiledMapParser::TiledMapParser(HeaderCallback on_header, LayerCallback on_layer)
+        : on_header_(std::move(on_header)), on_layer_(std::move(on_layer))
+    {
+    }
+
+    bool TiledMapParser::parse(std::string_view content)
+    {
+        error_.clear();
+        TiledSaxHandler handler(on_header_, on_layer_);
+        const bool result = nlohmann::json::sax_parse(content.data(), content.data() + content.size(), &handler);
+        error_ = std::move(handler.error_);
+        has_layers_ = handler.has_layers_;
+        return result && error_.empty();
+    }
+
+    bool TiledMapParser::decodeLayerData(std::string_view encoded,
+                                         std::string_view encoding,
+                                         std::string_view compression,
+                                         size_t tile_count,
+                                         std::vector<uint32_t> &out)
+    {
+        if (encoding != "base64")
+        {
+            spdlog::error("Unsupported layer encoding: {}", encoding);
+            return false;
+        }
+        std::string bytes;
+        if (!decodeBase64(encoded, bytes))
+        {
+            spdlog::error("Invalid base64 layer data");
+            return false;
+        }
+        if (!compression.empty())
+        {
+            std::string raw;
+            if (!decompress(compression, bytes, tile_count * 4, raw))
+                return false;
+            bytes = std::move(raw);
+        }
+        if (bytes.size() % 4 != 0 || (tile_count != 0 && bytes.size() != tile_count * 4))
+        {
+            spdlog::error("Layer data size mismatch: {} bytes, expected {} tiles", bytes.size(), tile_count);
+            return false;
+        }
+
+        // 每个 GID 为小端序的 32 位无符号整数
+        out.resize(bytes.size() / 4);
+        const auto *data = reinterpret_cast<const unsigned char *>(bytes.data());
+        for (size_t i = 0; i < out.size(); ++i)
+        {
+            out[i] = static_cast<uint32_t>(data[i * 4]) |
+                     static_cast<uint32_t>(data[i * 4 + 1]) << 8 |
+                     static_cast<uint32_t>(data[i * 4 + 2]) << 16 |
+                     static_cast<uint32_t>(data[i * 4 + 3]) << 24;
+        }
+        return true;
+    }
+}
@@ -0,0 +1,71 @@
+#pragma once
+#include <nlohmann/json.hpp>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace engine::loader
+{
+    /**
+     * @brief 流式解析得到的单个图层数据
+     * @note 瓦片图层的 data 不进入 json，而是直接解码为 GID 数组，避免每个瓦片一个 json 节点
+     */
+    struct TiledLayer
+    {
+        nlohmann::json meta_;        ///< @brief 图层元数据（不含 data 字段）
+        std::vector<uint32_t> gids_; ///< @brief 瓦片图层的 GID 数组（包含翻转标志位）
+    };
+
+    /**
+     * @brief Tiled 地图 (.tmj) 流式解析器，基于 nlohmann::json 的 SAX 接口
+     *
+     * 与一次性解析为 json DOM 不同：
+     * 1. 图层 data 数组直接写入 std::vector<uint32_t>；
+     * 2. 支持 base64 编码的图层数据（可选 zlib/gzip/zstd 压缩，取决于构建时是否找到对应库）；
+     * 3. 每个顶层图层解析完成即回调。由于图层依赖地图头信息（尺寸、图块集），
+     *    若头信息还不完整（Tiled 按字母序输出，"layers" 在 "tilesets"/"width" 之前），
+     *    则先缓存图层，待头信息完整后按原顺序派发。
+     */
+    class TiledMapParser final
+    {
+    public:
+        using HeaderCallback = std::function<void(const nlohmann::json &header)>; ///< @brief 地图头信息回调（不含 layers）
+        using LayerCallback = std::function<void(TiledLayer &layer)>;             ///< @brief 顶层图层回调
+
+    private:
+        HeaderCallback on_header_;
+        LayerCallback on_layer_;
+        std::string error_;       ///< @brief 最近一次解析的错误信息
+        bool has_layers_{false};  ///< @brief 地图中是否存在 layers 数组
+
+    public:
+        TiledMapParser(HeaderCallback on_header, LayerCallback on_layer);
+
+        /**
+         * @brief 解析地图文本内容，过程中依次触发头信息回调和图层回调
+         * @param content 完整的 .tmj 文件内容
+         * @return true 解析成功，false 解析失败（错误信息见 getError()）
+         */
+        [[nodiscard]] bool parse(std::string_view content);
+
+        /**
+         * @brief 解码 Tiled 编码后的图层数据 (base64，可带 zlib/gzip/zstd 压缩)
+         * @param encoded 编码后的字符串
+         * @param encoding 编码方式，目前只支持 "base64"
+         * @param compression 压缩方式，"" / "zlib" / "gzip" / "zstd"
+         * @param tile_count 图层瓦片数量 (宽 * 高)，用于校验和预分配
+         * @param out 输出的 GID 数组
+         * @return true 解码成功，false 解码失败
+         */
+        [[nodiscard]] static bool decodeLayerData(std::string_view encoded,
+                                                  std::string_view encoding,
+                                                  std::string_view compression,
+                                                  size_t tile_count,
+                                                  std::vector<uint32_t> &out);
+
+        const std::string &getError() const { return error_; }
+        bool hasLayers() const { return has_layers_; }
+    };
+}
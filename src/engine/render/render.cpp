@@ -4,6 +4,7 @@
 #include <spdlog/spdlog.h>
 #include <SDL3/SDL.h>
 #include <stdexcept>
+#include <cmath>
 #include <entt/core/hashed_string.hpp>
 
 using namespace entt::literals;
@@ -76,10 +77,10 @@ void engine::render::Renderer::drawFilledCircle(const Camera &camera, const glm:
 
 void engine::render::Renderer::drawSprite(const Camera &camera, const component::Sprite &sprite, const glm::vec2 &position, const glm::vec2 &size, const float rotation, const engine::utils::FColor &color)
 {
-    auto texture = resource_manager_->getTexture(sprite.texture_id_, sprite.texture_path_);
+    auto texture = resource_manager_->getTexture(sprite.texture_);
     if (!texture)
     {
-        spdlog::error("Texture not found:{}", sprite.texture_id_);
+        spdlog::error("Texture not found:{}", sprite.texture_.getPath());
         return;
     }
 
@@ -107,7 +108,7 @@ void engine::render::Renderer::drawSprite(const Camera &camera, const component:
 
     if (!SDL_RenderTextureRotated(renderer_, texture, &src_rect, &dest_rect, rotation, NULL, sprite.is_flipped_ ? SDL_FLIP_HORIZONTAL : SDL_FLIP_NONE))
     {
-        spdlog::error("Render texture failed:{},{}", sprite.texture_id_, SDL_GetError());
+        spdlog::error("Render texture failed:{},{}", sprite.texture_.getPath(), SDL_GetError());
     }
 }
 
@@ -164,7 +165,7 @@ void engine::render::Renderer::drawUIImage(const engine::render::Image &image, c
         spdlog::error("Invalid source rectangle:{}", image.getTextureId());
         return;
     }
-    SDL_FRect dest_rect = {position.x, position.y, 0, 0};
+    SDL_FRect dest_rect = {position.x - ui_origin_.x, position.y - ui_origin_.y, 0, 0};
     if (size.has_value())
     {
         dest_rect.w = size.value().x;
@@ -184,7 +185,7 @@ void engine::render::Renderer::drawUIImage(const engine::render::Image &image, c
 void engine::render::Renderer::drawUIFillRect(const engine::utils::Rect &rect, const engine::utils::FColor &color)
 {
     setDrawColorFloat(color.r, color.g, color.b, color.a);
-    SDL_FRect sdl_rect = {rect.position.x, rect.position.y, rect.size.x, rect.size.y};
+    SDL_FRect sdl_rect = {rect.position.x - ui_origin_.x, rect.position.y - ui_origin_.y, rect.size.x, rect.size.y};
     if (!SDL_RenderFillRect(renderer_, &sdl_rect))
     {
         spdlog::error("Render fill rect failed:{}", SDL_GetError());
@@ -192,6 +193,64 @@ void engine::render::Renderer::drawUIFillRect(const engine::utils::Rect &rect, c
     setDrawColorFloat(0.0f, 0.0f, 0.0f, 1.0f);
 }
 
+SDL_Texture *engine::render::Renderer::createRenderTarget(const glm::vec2 &size)
+{
+    const int width = static_cast<int>(std::ceil(size.x));
+    const int height = static_cast<int>(std::ceil(size.y));
+    if (width <= 0 || height <= 0)
+    {
+        spdlog::error("Invalid render target size:{}x{}", width, height);
+        return nullptr;
+    }
+    auto texture = SDL_CreateTexture(renderer_, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, width, height);
+    if (!texture)
+    {
+        spdlog::error("Create render target failed:{}", SDL_GetError());
+        return nullptr;
+    }
+    // 纹理中的内容是以普通alpha混合绘制到透明背景上的，颜色已经乘过alpha，因此以预乘alpha的方式绘制到屏幕
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND_PREMULTIPLIED);
+    SDL_SetTextureScaleMode(texture, SDL_SCALEMODE_NEAREST);
+    return texture;
+}
+
+std::optional<engine::render::Renderer::RenderTargetState> engine::render::Renderer::pushRenderTarget(SDL_Texture *target, const glm::vec2 &ui_origin)
+{
+    RenderTargetState previous{SDL_GetRenderTarget(renderer_), ui_origin_};
+    if (!SDL_SetRenderTarget(renderer_, target))
+    {
+        spdlog::error("Set render target failed:{}", SDL_GetError());
+        return std::nullopt;
+    }
+    ui_origin_ = ui_origin;
+    setDrawColorFloat(0.0f, 0.0f, 0.0f, 0.0f);
+    if (!SDL_RenderClear(renderer_))
+    {
+        spdlog::error("Clear render target failed:{}", SDL_GetError());
+    }
+    setDrawColorFloat(0.0f, 0.0f, 0.0f, 1.0f);
+    return previous;
+}
+
+void engine::render::Renderer::popRenderTarget(const RenderTargetState &previous)
+{
+    if (!SDL_SetRenderTarget(renderer_, previous.target_))
+    {
+        spdlog::error("Restore render target failed:{}", SDL_GetError());
+    }
+    ui_origin_ = previous.ui_origin_;
+}
+
+void engine::render::Renderer::drawUITexture(SDL_Texture *texture, const glm::vec2 &position, const glm::vec2 &size)
+{
+    SDL_FRect dest_rect = {position.x - ui_origin_.x, position.y - ui_origin_.y, size.x, size.y};
+    SDL_FRect src_rect = {0.0f, 0.0f, size.x, size.y};
+    if (!SDL_RenderTexture(renderer_, texture, &src_rect, &dest_rect))
+    {
+        spdlog::error("Render texture failed:{}", SDL_GetError());
+    }
+}
+
 void engine::render::Renderer::present()
 {
     SDL_RenderPresent(renderer_);
@@ -6,6 +6,7 @@
 #include "../component/sprite_component.h"
 struct SDL_Renderer;
 struct SDL_FRect;
+struct SDL_Texture;
 
 namespace engine::resource
 {
@@ -25,7 +26,15 @@ namespace engine::render
         /// @brief 指向资源管理器的非拥有指针
         engine::resource::ResourceManager *resource_manager_{nullptr};
         engine::utils::FColor background_color_{0.0f, 0.0f, 0.0f, 1.0f}; ///< @brief 清除屏幕的颜色（默认黑色），可调用setBgColorFloat设置
+        glm::vec2 ui_origin_{0.0f, 0.0f};                                ///< @brief UI绘制坐标的原点（渲染到纹理时为纹理左上角的屏幕坐标）
     public:
+        /// @brief 渲染目标状态（用于恢复之前的渲染目标）
+        struct RenderTargetState
+        {
+            SDL_Texture *target_{nullptr};
+            glm::vec2 ui_origin_{0.0f, 0.0f};
+        };
+
         Renderer(SDL_Renderer *sdl_renderer, engine::resource::ResourceManager *resource_manager);
         Renderer(const Renderer &) = delete;
         Renderer &operator=(const Renderer &) = delete;
@@ -69,6 +78,19 @@ namespace engine::render
         void drawUIImage(const engine::render::Image &image, const glm::vec2 &position, const std::optional<glm::vec2> &size = std::nullopt);
 
         void drawUIFillRect(const engine::utils::Rect &rect, const engine::utils::FColor &color);
+
+        /// @brief 创建可作为渲染目标的纹理（用于UI缓存），失败返回nullptr，由调用者负责销毁
+        SDL_Texture *createRenderTarget(const glm::vec2 &size);
+        /**
+         * @brief 将之后的绘制重定向到纹理（纹理会被清空为透明）
+         * @param target 渲染目标纹理
+         * @param ui_origin 纹理左上角对应的UI坐标，之后的UI绘制都以此为原点
+         * @return 之前的渲染目标状态（交给 popRenderTarget 恢复），失败返回nullopt
+         */
+        std::optional<RenderTargetState> pushRenderTarget(SDL_Texture *target, const glm::vec2 &ui_origin);
+        void popRenderTarget(const RenderTargetState &previous);
+        /// @brief 绘制 createRenderTarget 创建的纹理（内容为预乘alpha）
+        void drawUITexture(SDL_Texture *texture, const glm::vec2 &position, const glm::vec2 &size);
         /// @brief 更新屏幕
         void present();
         /// @brief 清空屏幕
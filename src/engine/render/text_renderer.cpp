@@ -57,13 +57,14 @@ void engine::render::TextRenderer::drawUIText(const std::string &text, entt::id_
         spdlog::error("TTF_CreateText failed");
         return;
     }
+    const glm::vec2 draw_position = position - ui_origin_;
     TTF_SetTextColorFloat(temp_text_object, 0.0f, 0.0f, 0.0f, 1.0f);
-    if (!TTF_DrawRendererText(temp_text_object, position.x + 2, position.y + 2))
+    if (!TTF_DrawRendererText(temp_text_object, draw_position.x + 2, draw_position.y + 2))
     {
         spdlog::error("TTF_DrawRendererText failed", SDL_GetError());
     }
     TTF_SetTextColorFloat(temp_text_object, color.r, color.g, color.b, color.a);
-    if (!TTF_DrawRendererText(temp_text_object, position.x, position.y))
+    if (!TTF_DrawRendererText(temp_text_object, draw_position.x, draw_position.y))
     {
         spdlog::error("drawUIText 绘制临时 TTF_Text 失败: {}", SDL_GetError());
     }
@@ -20,6 +20,7 @@ namespace engine::render
         SDL_Renderer *sdl_renderer_ = nullptr;
         engine::resource::ResourceManager *resource_manager_ = nullptr;
         TTF_TextEngine *text_engine_ = nullptr;
+        glm::vec2 ui_origin_{0.0f, 0.0f}; ///< @brief UI文字坐标的原点（渲染到纹理时为纹理左上角的屏幕坐标）
 
     public:
         TextRenderer(SDL_Renderer *sdl_renderer, engine::resource::ResourceManager *resource_manager);
@@ -35,6 +36,9 @@ namespace engine::render
                         const engine::utils::FColor &color = {1.0f, 1.0f, 1.0f, 1.0f});
         void drawText(const Camera &camera, const std::string &text, entt::id_type font_id, int font_size,
                       const glm::vec2 &position, const engine::utils::FColor &color = {1.0f, 1.0f, 1.0f, 1.0f});
+        /// @brief 设置UI文字坐标的原点（与 Renderer::pushRenderTarget 的 ui_origin 一致）
+        void setUIOrigin(const glm::vec2 &ui_origin) { ui_origin_ = ui_origin; }
+        const glm::vec2 &getUIOrigin() const { return ui_origin_; }
         glm::vec2 getTextSize(const std::string &text, entt::id_type font_id, int font_size, const std::string &font_path = "");
     };
 }
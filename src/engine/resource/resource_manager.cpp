@@ -102,6 +102,16 @@ SDL_Texture *engine::resource::ResourceManager::getTexture(entt::hashed_string s
 {
     return texture_manager_->getTexture(str_hs);
 }
+SDL_Texture *engine::resource::ResourceManager::getTexture(TextureHandle handle)
+{
+    return texture_manager_->getTexture(handle);
+}
+
+SDL_Texture *engine::resource::ResourceManager::loadTexture(TextureHandle handle)
+{
+    return texture_manager_->loadTexture(handle);
+}
+
 void engine::resource::ResourceManager::unloadTexture(entt::id_type id)
 {
     texture_manager_->unloadTexture(id);
@@ -116,6 +126,11 @@ glm::vec2 engine::resource::ResourceManager::getTextureSize(entt::id_type id, co
 {
     return texture_manager_->getTextureSize(id, file_path);
 }
+
+glm::vec2 engine::resource::ResourceManager::getTextureSize(TextureHandle handle)
+{
+    return texture_manager_->getTextureSize(handle);
+}
 void engine::resource::ResourceManager::clearTextures()
 {
     texture_manager_->clearTextures();
@@ -1,4 +1,5 @@
 #pragma once
+#include "texture_handle.h"
 #include <string>
 #include <memory>
 #include <glm/glm.hpp>
@@ -42,9 +43,12 @@ namespace engine::resource
         SDL_Texture *loadTexture(entt::hashed_string str_hs);
         SDL_Texture *getTexture(entt::id_type id, const std::string &file_path = "");
         SDL_Texture *getTexture(entt::hashed_string str_hs);
+        SDL_Texture *getTexture(TextureHandle handle); ///< @brief 通过纹理句柄获取（渲染精灵时使用，只需一次数组访问）
+        SDL_Texture *loadTexture(TextureHandle handle);
         void unloadTexture(entt::id_type id);
         glm::vec2 getTextureSize(entt::id_type id, const std::string &file_path = "");
         glm::vec2 getTextureSize(entt::hashed_string str_hs);
+        glm::vec2 getTextureSize(TextureHandle handle);
         void clearTextures();
 
         //=====Sound=====
@@ -0,0 +1,28 @@
+#pragma once
+#include "../utils/string_interner.h"
+#include <string>
+#include <string_view>
+
+namespace engine::resource
+{
+    /**
+     * @brief 纹理句柄，以驻留后的纹理路径索引作为纹理表的下标
+     *
+     * 渲染时TextureManager直接用下标访问纹理表，不再需要计算哈希或查找unordered_map；
+     * 第一次使用时才根据路径加载（或关联已加载的）纹理。
+     */
+    class TextureHandle
+    {
+        engine::utils::InternedString path_; ///< @brief 驻留的纹理路径
+
+    public:
+        TextureHandle() = default;
+        explicit TextureHandle(std::string_view path) : path_(path) {}
+
+        uint32_t index() const { return path_.index(); }
+        const std::string &getPath() const { return path_.str(); }
+        bool isValid() const { return !path_.empty(); }
+
+        bool operator==(const TextureHandle &other) const { return path_ == other.path_; }
+    };
+}
@@ -2,6 +2,7 @@
 #include <SDL3_image/SDL_image.h>
 #include <spdlog/spdlog.h>
 #include <stdexcept>
+#include <algorithm>
 #include <entt/core/hashed_string.hpp>
 engine::resource::TextureManager::TextureManager(SDL_Renderer *renderer)
     : renderer_(renderer)
@@ -45,6 +46,28 @@ SDL_Texture *engine::resource::TextureManager::loadTexture(entt::hashed_string s
     return loadTexture(str_hs.value(), str_hs.data());
 }
 
+SDL_Texture *engine::resource::TextureManager::loadTexture(TextureHandle handle)
+{
+    if (!handle.isValid())
+    {
+        spdlog::error("Invalid texture handle");
+        return nullptr;
+    }
+    // 纹理仍然按路径哈希保存，句柄表只记录指针，之后通过句柄访问时不需要再计算哈希
+    const auto &file_path = handle.getPath();
+    SDL_Texture *texture = loadTexture(entt::hashed_string(file_path.c_str()), file_path);
+    if (!texture)
+    {
+        return nullptr;
+    }
+    if (handle.index() >= handle_table_.size())
+    {
+        handle_table_.resize(handle.index() + 1, nullptr);
+    }
+    handle_table_[handle.index()] = texture;
+    return texture;
+}
+
 SDL_Texture *engine::resource::TextureManager::getTexture(entt::id_type id, const std::string &file_path)
 {
     auto it = textures_.find(id);
@@ -84,12 +107,26 @@ glm::vec2 engine::resource::TextureManager::getTextureSize(entt::hashed_string s
     return getTextureSize(str_hs.value(), str_hs.data());
 }
 
+glm::vec2 engine::resource::TextureManager::getTextureSize(TextureHandle handle)
+{
+    SDL_Texture *texture = getTexture(handle);
+    glm::vec2 size{0.0f, 0.0f};
+    if (!texture || !SDL_GetTextureSize(texture, &size.x, &size.y))
+    {
+        spdlog::error("Get texture size failed: {}", handle.getPath());
+        return glm::vec2(0.0f, 0.0f);
+    }
+    return size;
+}
+
 void engine::resource::TextureManager::unloadTexture(entt::id_type id)
 {
     auto it = textures_.find(id);
     if (it != textures_.end())
     {
         spdlog::info("Unload texture id: {}", id);
+        // 同时解除句柄表中的关联，下次通过句柄访问时会重新加载
+        std::replace(handle_table_.begin(), handle_table_.end(), it->second.get(), static_cast<SDL_Texture *>(nullptr));
         textures_.erase(it);
     }
     else
@@ -104,6 +141,7 @@ void engine::resource::TextureManager::clearTextures()
     {
         /* code */
         spdlog::info("Clear {} textures", textures_.size());
+        handle_table_.clear();
         textures_.clear();
     }
 }
@@ -1,8 +1,10 @@
 #pragma once
+#include "texture_handle.h"
 #include <memory>
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
+#include <vector>
 #include <SDL3/SDL_render.h>
 #include <glm/glm.hpp>
 #include <entt/core/fwd.hpp>
@@ -33,6 +35,9 @@ namespace engine::resource
         /// @brief 存储文件路径和指向管理纹理贴图的指针
         std::unordered_map<entt::id_type, std::unique_ptr<SDL_Texture, SDLTextureDeleter>> textures_;
 
+        /// @brief 纹理句柄表（下标为TextureHandle::index()，非拥有指针），渲染时直接按下标访问
+        std::vector<SDL_Texture *> handle_table_;
+
         /// @brief 指向主SDL渲染器的非拥有指针
         SDL_Renderer *renderer_{nullptr};
 
@@ -41,6 +46,7 @@ namespace engine::resource
         /// @return
         SDL_Texture *loadTexture(entt::id_type id, const std::string &file_path);
         SDL_Texture *loadTexture(entt::hashed_string str_hs);
+        SDL_Texture *loadTexture(TextureHandle handle);
 
         /// @brief 卸载纹理资源
         /// @param file_path
@@ -51,12 +57,22 @@ namespace engine::resource
         /// @return
         SDL_Texture *getTexture(entt::id_type id, const std::string &file_path);
         SDL_Texture *getTexture(entt::hashed_string str_hs);
+        /// @brief 通过句柄获取纹理（已关联时只是一次数组访问，否则加载并关联）
+        SDL_Texture *getTexture(TextureHandle handle)
+        {
+            if (auto index = handle.index(); index < handle_table_.size() && handle_table_[index])
+            {
+                return handle_table_[index];
+            }
+            return loadTexture(handle);
+        }
 
         /// @brief 获取纹理尺寸
         /// @param file_path
         /// @return
         glm::vec2 getTextureSize(entt::id_type id, const std::string &file_path);
         glm::vec2 getTextureSize(entt::hashed_string str_hs);
+        glm::vec2 getTextureSize(TextureHandle handle);
         /// @brief 清除所有纹理资源
         void clearTextures();
     };
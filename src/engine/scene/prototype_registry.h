@@ -0,0 +1,82 @@
+#pragma once
+#include <entt/entity/registry.hpp>
+#include <cstdint>
+#include <type_traits>
+#include <unordered_map>
+
+namespace engine::scene
+{
+    /**
+     * @brief 实体原型注册表，按键保存“已构建完成”的实体组件，用于快速克隆
+     *
+     * 原型保存在独立的注册表中，游戏中的系统不会遍历到它们。
+     * 克隆时对组件类型列表做一次折叠展开，直接拷贝组件数据，不再重新解析蓝图。
+     * @tparam Components 需要拷贝的组件类型列表（空结构体视为标签组件）
+     * @note 组件列表需要覆盖原型实体的所有组件，列表以外的组件不会被克隆
+     */
+    template <typename... Components>
+    class PrototypeRegistry
+    {
+        entt::registry registry_;                               ///< @brief 保存原型实体的独立注册表
+        std::unordered_map<uint64_t, entt::entity> prototypes_; ///< @brief 原型键 -> 原型实体
+
+    public:
+        bool contains(uint64_t key) const { return prototypes_.contains(key); }
+        size_t size() const { return prototypes_.size(); }
+
+        /**
+         * @brief 拷贝实体当前的组件作为原型（已存在的同键原型会被覆盖）
+         * @param key 原型键
+         * @param source 实体所在的注册表
+         * @param entity 作为原型的实体
+         */
+        void capture(uint64_t key, const entt::registry &source, entt::entity entity)
+        {
+            if (auto it = prototypes_.find(key); it != prototypes_.end())
+            {
+                registry_.destroy(it->second);
+            }
+            auto prototype = registry_.create();
+            (copyComponent<Components>(source, entity, registry_, prototype), ...);
+            prototypes_[key] = prototype;
+        }
+
+        /**
+         * @brief 将原型的组件拷贝到目标实体上
+         * @param key 原型键
+         * @param target 目标注册表
+         * @param entity 目标实体（不能已经拥有组件列表中的组件）
+         * @return true 克隆成功，false 原型不存在
+         */
+        [[nodiscard]] bool instantiate(uint64_t key, entt::registry &target, entt::entity entity) const
+        {
+            auto it = prototypes_.find(key);
+            if (it == prototypes_.end())
+                return false;
+            (copyComponent<Components>(registry_, it->second, target, entity), ...);
+            return true;
+        }
+
+        /// @brief 清空所有原型
+        void clear()
+        {
+            registry_.clear();
+            prototypes_.clear();
+        }
+
+    private:
+        template <typename T>
+        static void copyComponent(const entt::registry &from, entt::entity src, entt::registry &to, entt::entity dst)
+        {
+            if constexpr (std::is_empty_v<T>)
+            {
+                if (from.all_of<T>(src))
+                    to.emplace<T>(dst);
+            }
+            else if (const auto *value = from.try_get<T>(src); value)
+            {
+                to.emplace<T>(dst, *value);
+            }
+        }
+    };
+}
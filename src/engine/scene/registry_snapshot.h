@@ -0,0 +1,115 @@
+#pragma once
+#include <entt/entity/registry.hpp>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace engine::scene
+{
+    /**
+     * @brief 注册表快照，按组件类型紧凑保存实体与组件数据
+     *
+     * 与 entt::snapshot 不同，快照直接保存在内存中（不经过归档序列化），
+     * 恢复时先按原ID重建实体，再对每种组件批量 insert，适合“加载一次，反复恢复”的场景（如关卡重开）。
+     * @tparam Components 需要保存的组件类型列表（空结构体视为标签组件，只保存实体）
+     * @note 只能恢复到空的注册表中，这样才能保证实体ID与捕获时一致（组件中保存的实体ID依然有效）
+     */
+    template <typename... Components>
+    class RegistrySnapshot
+    {
+        /// @brief 单个组件类型的数据，实体与组件按相同顺序保存
+        template <typename T>
+        struct Pool
+        {
+            std::vector<entt::entity> entities_;
+            std::vector<T> values_;
+        };
+        /// @brief 标签组件只需要保存实体
+        template <typename T>
+            requires std::is_empty_v<T>
+        struct Pool<T>
+        {
+            std::vector<entt::entity> entities_;
+        };
+
+        std::vector<entt::entity> entities_;    ///< @brief 捕获时的所有有效实体
+        std::tuple<Pool<Components>...> pools_; ///< @brief 每种组件类型一个数据池
+        bool valid_{false};                     ///< @brief 是否已捕获
+
+    public:
+        /// @brief 捕获注册表当前状态（覆盖之前的快照）
+        void capture(entt::registry &registry)
+        {
+            entities_.clear();
+            for (auto entity : registry.view<entt::entity>())
+            {
+                entities_.push_back(entity);
+            }
+            (capturePool<Components>(registry), ...);
+            valid_ = true;
+        }
+
+        /**
+         * @brief 将快照恢复到注册表中
+         * @param registry 目标注册表（必须为空）
+         * @return true 恢复成功，false 快照无效或注册表非空
+         */
+        [[nodiscard]] bool restore(entt::registry &registry) const
+        {
+            if (!valid_)
+                return false;
+            if (auto view = registry.view<entt::entity>(); view.begin() != view.end())
+                return false;
+            for (auto entity : entities_)
+            {
+                registry.create(entity); // 空注册表中以原ID为提示创建，保证ID一致
+            }
+            (restorePool<Components>(registry), ...);
+            return true;
+        }
+
+        bool isValid() const { return valid_; }
+        size_t getEntityCount() const { return entities_.size(); }
+
+    private:
+        template <typename T>
+        void capturePool(entt::registry &registry)
+        {
+            auto &pool = std::get<Pool<T>>(pools_);
+            pool.entities_.clear();
+            auto &storage = registry.storage<T>();
+            pool.entities_.reserve(storage.size());
+            if constexpr (std::is_empty_v<T>)
+            {
+                pool.entities_.assign(storage.begin(), storage.end());
+            }
+            else
+            {
+                pool.values_.clear();
+                pool.values_.reserve(storage.size());
+                for (auto [entity, value] : storage.each())
+                {
+                    pool.entities_.push_back(entity);
+                    pool.values_.push_back(value);
+                }
+            }
+        }
+
+        template <typename T>
+        void restorePool(entt::registry &registry) const
+        {
+            const auto &pool = std::get<Pool<T>>(pools_);
+            if (pool.entities_.empty())
+                return;
+            if constexpr (std::is_empty_v<T>)
+            {
+                registry.insert<T>(pool.entities_.begin(), pool.entities_.end());
+            }
+            else
+            {
+                registry.insert<T>(pool.entities_.begin(), pool.entities_.end(), pool.values_.begin());
+            }
+        }
+    };
+}
@@ -38,6 +38,14 @@ void engine::scene::Scene::render()
     ui_manager_->render(context_);
 }
 
+void engine::scene::Scene::invalidateRenderCache(bool device_reset)
+{
+    if (ui_manager_)
+    {
+        ui_manager_->invalidateRenderCache(device_reset);
+    }
+}
+
 void engine::scene::Scene::clean()
 {
     if (!is_initialized_)
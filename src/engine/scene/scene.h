@@ -62,6 +62,9 @@ namespace engine::scene
         void requestReplaceScene(std::unique_ptr<engine::scene::Scene> &&scene);
         /// @brief 请求退出
         void requestQuit();
+        /// @brief 渲染目标内容丢失时调用，使UI中的缓存纹理重新渲染
+        /// @param device_reset 渲染设备是否被重置（纹理需要重新创建）
+        void invalidateRenderCache(bool device_reset);
 
         void setName(const std::string &name) { scene_name_ = name; }
         std::string getName() const { return scene_name_; }
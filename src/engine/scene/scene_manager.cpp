@@ -10,6 +10,7 @@ engine::scene::SceneManager::SceneManager(engine::core::Context &context)
     context_.getDispatcher().sink<engine::utils::PopSceneEvent>().connect<&SceneManager::onPopScene>(this);
     context_.getDispatcher().sink<engine::utils::PushSceneEvent>().connect<&SceneManager::onPushScene>(this);
     context_.getDispatcher().sink<engine::utils::ReplaceSceneEvent>().connect<&SceneManager::onReplaceScene>(this);
+    context_.getDispatcher().sink<engine::utils::RenderTargetsResetEvent>().connect<&SceneManager::onRenderTargetsReset>(this);
     spdlog::info("SceneManager created");
 }
 
@@ -82,6 +83,16 @@ void engine::scene::SceneManager::onReplaceScene(engine::utils::ReplaceSceneEven
     pending_scene_ = std::move(event.scene);
 }
 
+void engine::scene::SceneManager::onRenderTargetsReset(const engine::utils::RenderTargetsResetEvent &event)
+{
+    // 栈中所有场景都会被渲染，它们的UI缓存都需要重新渲染
+    for (const auto &scene : scenes_stack_)
+    {
+        if (scene)
+            scene->invalidateRenderCache(event.device_reset_);
+    }
+}
+
 void engine::scene::SceneManager::processPendingActions()
 {
     if (pending_action_ == PendingAction::None)
@@ -50,6 +50,7 @@ namespace engine::scene
         void onPopScene();
         void onPushScene(engine::utils::PushSceneEvent &event);
         void onReplaceScene(engine::utils::ReplaceSceneEvent &event);
+        void onRenderTargetsReset(const engine::utils::RenderTargetsResetEvent &event);
 
         void processPendingActions();
         void pushScene(std::unique_ptr<Scene> &&scene);
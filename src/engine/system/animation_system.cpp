@@ -27,16 +27,16 @@ namespace engine::system
             auto &sprite_component = view.get<engine::component::SpriteComponent>(entity);
 
             // 如果动画不存在，则跳过
-            auto it = anim_component.animations_.find(anim_component.current_animation_id_);
-            if (it == anim_component.animations_.end())
+            if (!anim_component.hasClip())
             {
                 continue;
             }
 
-            // 获取当前动画
-            auto &current_animation = it->second;
+            // 获取当前动画片段（帧数据保存在共享的片段集合中）
+            const auto &clip_set = *anim_component.clip_set_;
+            const auto &current_clip = clip_set.getClip(anim_component.current_clip_index_);
             // 如果没有帧，则跳过
-            if (current_animation.frames_.empty())
+            if (current_clip.frame_count_ == 0)
             {
                 continue;
             }
@@ -45,7 +45,7 @@ namespace engine::system
             anim_component.current_time_ms_ += dt * 1000.0f * anim_component.speed_;
 
             // 获取当前帧
-            const auto &current_frame = current_animation.frames_[anim_component.current_frame_index_];
+            const auto &current_frame = clip_set.getFrame(current_clip, anim_component.current_frame_index_);
 
             // 检查是否需要切换到下一帧
             if (anim_component.current_time_ms_ >= current_frame.duration_ms_)
@@ -53,33 +53,31 @@ namespace engine::system
                 anim_component.current_time_ms_ -= current_frame.duration_ms_;
                 anim_component.current_frame_index_++;
 
-                // 检查是否要发送动画事件
-                if (current_animation.events_.find(anim_component.current_frame_index_) != current_animation.events_.end())
-                {
-                    dispatcher_.enqueue(engine::utils::AnimationEvent{entity,
-                                                                      current_animation.events_.at(anim_component.current_frame_index_),
-                                                                      anim_component.current_animation_id_});
-                }
-
                 // 处理动画播放完成
-                if (anim_component.current_frame_index_ >= current_animation.frames_.size())
+                if (anim_component.current_frame_index_ >= current_clip.frame_count_)
                 {
-                    if (current_animation.loop_)
+                    if (anim_component.loop_)
                     {
                         anim_component.current_frame_index_ = 0;
                     }
                     else
                     {
                         // 动画播放完毕且不循环，停在最后一帧
-                        anim_component.current_frame_index_ = current_animation.frames_.size() - 1;
+                        anim_component.current_frame_index_ = current_clip.frame_count_ - 1;
                         // 发送动画播放完成事件
-                        dispatcher_.enqueue(engine::utils::AnimationFinishedEvent{entity, anim_component.current_animation_id_});
+                        dispatcher_.enqueue(engine::utils::AnimationFinishedEvent{entity, current_clip.id_});
                     }
                 }
+                // 检查是否要发送动画事件 (事件在编译片段集合时已写入对应帧，第0帧的事件不会触发)
+                else if (const auto event_id = clip_set.getFrame(current_clip, anim_component.current_frame_index_).event_id_;
+                         event_id != entt::id_type{entt::null})
+                {
+                    dispatcher_.enqueue(engine::utils::AnimationEvent{entity, event_id, current_clip.id_});
+                }
             }
 
             // 更新 SpriteComponent 的源矩形 （根据当前动画帧的源矩形信息）
-            const auto &next_frame = current_animation.frames_[anim_component.current_frame_index_];
+            const auto &next_frame = clip_set.getFrame(current_clip, anim_component.current_frame_index_);
             sprite_component.sprite_.src_rect_ = next_frame.src_rect_;
         }
     }
@@ -89,10 +87,8 @@ namespace engine::system
         // 使用try_get方法来安全获取可能存在的组件。如果不存在则返回nullptr
         if (auto anim = registry_.try_get<engine::component::AnimationComponent>(event.entity_); anim)
         {
-            anim->current_animation_id_ = event.animation_id_; // 替换动画ID
-            anim->current_frame_index_ = 0;
-            anim->current_time_ms_ = 0.0f;
-            anim->animations_.at(event.animation_id_).loop_ = event.loop_;
+            anim->play(event.animation_id_); // 替换动画
+            anim->loop_ = event.loop_;       // 循环设置只影响此实体，共享的片段数据不变
         }
     }
 
@@ -1,11 +1,16 @@
 #include "audio_system.h"
 #include "../core/context.h"
 #include "../component/audio_component.h"
+#include "../component/transform_component.h"
+#include "../render/camera.h"
 #include "../audio/audio_player.h"
 #include <entt/entity/registry.hpp>
 #include <entt/signal/dispatcher.hpp>
 #include <entt/core/hashed_string.hpp>
-#include <spdlog/spdlog.h>
+#include "../core/time.h"
+#include "../utils/log.h"
+#include <algorithm>
+#include <cmath>
 
 using namespace entt::literals;
 
@@ -25,13 +30,98 @@ namespace engine::system
         dispatcher.sink<engine::utils::PlaySoundEvent>().connect<&AudioSystem::onPlaySoundEvent>(this);
     }
 
+    void AudioSystem::update()
+    {
+        clock_ += context_.getTime().getUnScaledDeltaTime();
+        if (pending_.empty())
+            return;
+
+        auto &audio_player = context_.getAudioPlayer();
+        const auto &settings = audio_player.getCoalesceSettings();
+
+        // 优先级高的先播放，同优先级时合并数量多的先播放
+        std::sort(pending_.begin(), pending_.end(), [&audio_player](const PendingSound &a, const PendingSound &b)
+                  {
+                      int priority_a = audio_player.getSoundSettings(a.sound_id_).priority_;
+                      int priority_b = audio_player.getSoundSettings(b.sound_id_).priority_;
+                      return priority_a != priority_b ? priority_a > priority_b : a.count_ > b.count_; });
+
+        int played = 0;
+        for (const auto &pending : pending_)
+        {
+            if (auto it = last_played_.find(pending.sound_id_); it != last_played_.end() && clock_ - it->second < settings.window_)
+            {
+                stats_.coalesced_ += pending.count_;
+                continue;
+            }
+            if (played >= settings.max_per_frame_)
+            {
+                stats_.over_budget_ += pending.count_;
+                continue;
+            }
+            // 合并的数量越多音量略微越大（对数增长，最多1.5倍），避免多个相同音效叠加造成削波
+            float gain = settings.scale_gain_ ? std::min(1.0f + 0.15f * std::log2(static_cast<float>(pending.count_)), 1.5f) : 1.0f;
+            audio_player.playSound(pending.sound_id_, -1, gain * pending.gain_, pending.pan_);
+            last_played_[pending.sound_id_] = clock_;
+            stats_.coalesced_ += pending.count_ - 1;
+            ++stats_.played_;
+            ++played;
+        }
+        MW_LOG_DEBUG(AUDIO, "Sound flush: {} unique, {} played", pending_.size(), played);
+        pending_.clear();
+    }
+
+    void AudioSystem::enqueueSound(entt::id_type sound_id, const std::optional<glm::vec2> &position)
+    {
+        ++stats_.requested_;
+        float gain = 1.0f;
+        float pan = 0.0f;
+        if (position && !computeSpatial(*position, gain, pan))
+        {
+            ++stats_.culled_;
+            return;
+        }
+
+        auto it = std::find_if(pending_.begin(), pending_.end(), [sound_id](const PendingSound &pending)
+                               { return pending.sound_id_ == sound_id; });
+        if (it != pending_.end())
+        {
+            // 合并时保留最响（离视口最近）的发声位置
+            ++it->count_;
+            if (gain > it->gain_)
+            {
+                it->gain_ = gain;
+                it->pan_ = pan;
+            }
+            return;
+        }
+        pending_.push_back({sound_id, 1, gain, pan});
+    }
+
+    bool AudioSystem::computeSpatial(const glm::vec2 &position, float &gain, float &pan) const
+    {
+        const auto &camera = context_.getCamera();
+        const auto &settings = context_.getAudioPlayer().getPositionalSettings();
+        const glm::vec2 half_size = camera.getViewportSize() * 0.5f;
+        const glm::vec2 offset = position - (camera.getPosition() + half_size);
+
+        // 视口内不衰减，视口外按到视口边缘的距离线性衰减，达到剔除距离时不再播放
+        const glm::vec2 outside = glm::max(glm::abs(offset) - half_size, glm::vec2(0.0f));
+        const float distance = glm::length(outside);
+        if (distance >= settings.cull_distance_)
+            return false;
+        gain = 1.0f - distance / settings.cull_distance_;
+        pan = half_size.x > 0.0f ? glm::clamp(offset.x / half_size.x, -1.0f, 1.0f) * settings.pan_strength_ : 0.0f;
+        return true;
+    }
+
     void AudioSystem::onPlaySoundEvent(const engine::utils::PlaySoundEvent &event)
     {
+        auto sound_id = event.sound_id_;
         // 如果没有传入目标实体，则直接播放全局音效
         if (event.entity_ == entt::null)
         {
-            spdlog::info("Play global sound: {}", event.sound_id_);
-            context_.getAudioPlayer().playSound(event.sound_id_);
+            MW_LOG_DEBUG(AUDIO, "Play global sound: {}", sound_id);
         }
         // 如果有传入目标实体，且实体有音效组件
         else if (auto audio_component = registry_.try_get<engine::component::AudioComponent>(event.entity_); audio_component)
@@ -40,22 +130,31 @@ namespace engine::system
             // 先尝试在目标实体的音效集合中查找
             if (it != audio_component->sounds_.end())
             {
-                spdlog::info("Sound found in entity ID: {}: {}", entt::to_integral(event.entity_), it->second);
-                context_.getAudioPlayer().playSound(it->second);
+                MW_LOG_DEBUG(AUDIO, "Sound found in entity ID: {}: {}", entt::to_integral(event.entity_), it->second);
+                sound_id = it->second;
                 // 如果没找到，则播放全局音效
             }
             else
             {
-                spdlog::info("No sound effect found for entity ID: {}: {}", entt::to_integral(event.entity_), event.sound_id_);
-                context_.getAudioPlayer().playSound(event.sound_id_);
+                MW_LOG_DEBUG(AUDIO, "No sound effect found for entity ID: {}: {}", entt::to_integral(event.entity_), event.sound_id_);
             }
         }
         // 如果有传入目标实体，但实体没有音效组件，也尝试播放全局音效
         else
         {
-            spdlog::info("No audio component in entity ID: {}, attempting to play global sound: {}", entt::to_integral(event.entity_), event.sound_id_);
-            context_.getAudioPlayer().playSound(event.sound_id_);
+            MW_LOG_DEBUG(AUDIO, "No audio component in entity ID: {}, attempting to play global sound: {}", entt::to_integral(event.entity_), event.sound_id_);
+        }
+
+        // 发声位置：优先使用事件中的位置，其次使用目标实体的位置，都没有则不做定位
+        auto position = event.position_;
+        if (!position && event.entity_ != entt::null)
+        {
+            if (auto transform = registry_.try_get<engine::component::TransformComponent>(event.entity_); transform)
+            {
+                position = transform->position_;
+            }
         }
+        enqueueSound(sound_id, position);
     }
 
-}
\ No newline at end of file
+}
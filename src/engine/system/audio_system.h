@@ -1,6 +1,9 @@
 #pragma once
 #include "../../engine/utils/events.h"
 #include <entt/entity/fwd.hpp>
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
 
 namespace engine::core
 {
@@ -10,19 +13,58 @@ namespace engine::core
 namespace engine::system
 {
 
+    /// @brief 音效合并统计
+    struct SoundCoalesceStats
+    {
+        size_t requested_{0};   ///< @brief 收到的播放请求数量
+        size_t played_{0};      ///< @brief 实际播放的数量
+        size_t coalesced_{0};   ///< @brief 被合并（同帧重复或处于合并窗口内）的数量
+        size_t over_budget_{0}; ///< @brief 超出每帧数量上限而被丢弃的数量
+        size_t culled_{0};      ///< @brief 发声位置离视口太远而被剔除的数量
+    };
+
     /**
      * @brief 音频系统，负责处理播放音频事件。
+     *
+     * 事件处理函数只记录（解析后的）音效ID，同一帧内相同的音效合并为一条；
+     * update() 时按优先级排序后统一播放：同一音效在合并窗口内只播放一次，
+     * 每帧播放数量不超过上限，可选按合并数量提高音量。
+     * 带有发声位置（事件位置或目标实体的变换组件）的音效根据相对摄像机视口的位置衰减并左右定位，
+     * 离视口太远的直接剔除，不占用声部。
      */
     class AudioSystem
     {
+        /// @brief 等待播放的音效
+        struct PendingSound
+        {
+            entt::id_type sound_id_;
+            int count_;  ///< @brief 合并的请求数量
+            float gain_; ///< @brief 距离衰减（合并时取最大值）
+            float pan_;  ///< @brief 声像（与gain_来自同一个发声位置）
+        };
+
         entt::registry &registry_;
         engine::core::Context &context_;
 
+        std::vector<PendingSound> pending_;                     ///< @brief 本帧等待播放的音效（每个ID一条）
+        std::unordered_map<entt::id_type, double> last_played_; ///< @brief 音效ID -> 上次播放的时间
+        double clock_{0.0};                                     ///< @brief 系统时钟（不受时间缩放影响，秒）
+        SoundCoalesceStats stats_;
+
     public:
         AudioSystem(entt::registry &registry, engine::core::Context &context);
         ~AudioSystem();
 
+        /// @brief 播放本帧合并后的音效（每帧调用一次）
+        void update();
+
+        const SoundCoalesceStats &getStats() const { return stats_; }
+
     private:
         void onPlaySoundEvent(const engine::utils::PlaySoundEvent &event);
+        /// @brief 记录待播放音效，同ID合并；有发声位置时计算衰减与声像，太远则直接剔除
+        void enqueueSound(entt::id_type sound_id, const std::optional<glm::vec2> &position);
+        /// @brief 根据发声位置与摄像机视口计算衰减和声像，超出剔除距离时返回false
+        bool computeSpatial(const glm::vec2 &position, float &gain, float &pan) const;
     };
 }
\ No newline at end of file
@@ -1,25 +1,17 @@
 #include "movement_system.h"
-#include "../component/velocity_component.h"
-#include "../component/transform_component.h"
-#include <spdlog/spdlog.h>
+#include "../utils/log.h"
 
 namespace engine::system
 {
 
     void MovementSystem::update(entt::registry &registry, float delta_time)
     {
-        spdlog::trace("MovementSystem::update");
-        // 获取感兴趣的实体 view
-        auto view = registry.view<engine::component::VelocityComponent, engine::component::TransformComponent>();
-
-        // 遍历获取的实体，获取组件并执行相关逻辑
-        for (auto entity : view)
+        MW_LOG_TRACE(SYSTEM, "MovementSystem::update");
+        // 遍历 owning group，速度与变换组件在各自数组中按相同顺序排列
+        for (auto [entity, velocity, transform] : group(registry).each())
         {
-            const auto &velocity = view.get<engine::component::VelocityComponent>(entity);
-            auto &transform = view.get<engine::component::TransformComponent>(entity);
-
             transform.position_ += velocity.velocity_ * delta_time; // 更新位置
         }
     }
 
-}
\ No newline at end of file
+}
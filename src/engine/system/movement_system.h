@@ -1,4 +1,6 @@
 #pragma once
+#include "../component/velocity_component.h"
+#include "../component/transform_component.h"
 #include <entt/entity/registry.hpp>
 
 namespace engine::system
@@ -12,6 +14,18 @@ namespace engine::system
     class MovementSystem
     {
     public:
+        /**
+         * @brief 获取（首次调用时创建）速度 + 变换组件的 owning group
+         *
+         * group 拥有这两种组件的存储，组内实体的组件在两个数组中按相同顺序紧密排列，遍历时无需稀疏集求交。
+         * 同一组件只能被一个 group 拥有，因此所有需要遍历“速度 + 变换”的系统都应通过此函数共用同一个 group。
+         * @note 应在场景初始化时调用一次完成声明；遍历过程中不要给其他实体添加/移除这两种组件。
+         */
+        static auto group(entt::registry &registry)
+        {
+            return registry.group<engine::component::VelocityComponent, engine::component::TransformComponent>();
+        }
+
         /**
          * @brief 更新所有拥有移动和变换组件的实体
          * @param registry entt注册表
@@ -19,4 +33,4 @@ namespace engine::system
          */
         void update(entt::registry &registry, float delta_time);
     };
-}
\ No newline at end of file
+}
@@ -4,6 +4,7 @@
 #include "../component/transform_component.h"
 #include "../component/sprite_component.h"
 #include "../component/render_component.h"
+#include <algorithm>
 
 namespace engine::system
 {
@@ -13,16 +14,37 @@ namespace engine::system
         registry.sort<component::RenderComponent>([](const auto &lhs, const auto &rhs)
                                                   { return lhs < rhs; });
         auto view = registry.view<component::RenderComponent, component::TransformComponent, component::SpriteComponent>();
-        // view.use<component::RenderComponent>();
+        // 以 RenderComponent 为主遍历，保证按上面排好的（图层, 深度）顺序迭代，图层回调才能插入到正确位置
+        view.use<component::RenderComponent>();
+        auto pass = layer_passes_.begin();
         for (auto entity : view)
         {
             const auto &render = view.get<component::RenderComponent>(entity);
+            // 进入更高的图层前，先调用较低图层的绘制回调
+            for (; pass != layer_passes_.end() && pass->first < render.layer_; ++pass)
+            {
+                pass->second(renderer, camera);
+            }
             const auto &transform = view.get<component::TransformComponent>(entity);
             const auto &sprite = view.get<component::SpriteComponent>(entity);
             auto position = transform.position_ + sprite.offset_; // 位置 = 变换组件的位置 + 精灵的偏移
             auto size = sprite.size_ * transform.scale_;          // 大小 = 精灵的大小 * 变换组件的缩放
             renderer.drawSprite(camera, sprite.sprite_, position, size, transform.rotation_, render.color_);
         }
+        // 剩余的绘制回调（图层高于所有实体）
+        for (; pass != layer_passes_.end(); ++pass)
+        {
+            pass->second(renderer, camera);
+        }
+    }
+
+    void RenderSystem::addLayerPass(int layer, LayerPass pass)
+    {
+        // 插入到同图层已有回调之后，保持添加顺序
+        auto it = std::upper_bound(layer_passes_.begin(), layer_passes_.end(), layer,
+                                   [](int value, const auto &entry)
+                                   { return value < entry.first; });
+        layer_passes_.emplace(it, layer, std::move(pass));
     }
 
 }
\ No newline at end of file
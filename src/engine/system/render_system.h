@@ -1,5 +1,8 @@
 #pragma once
 #include <entt/entt.hpp>
+#include <functional>
+#include <utility>
+#include <vector>
 
 namespace engine::render
 {
@@ -19,6 +22,22 @@ namespace engine::system
     class RenderSystem
     {
     public:
+        /// @brief 图层绘制回调，用于绘制不是实体的对象（如投射物池）
+        using LayerPass = std::function<void(render::Renderer &, const render::Camera &)>;
+
+    private:
+        std::vector<std::pair<int, LayerPass>> layer_passes_; ///< @brief 按图层升序保存的绘制回调
+
+    public:
+        /**
+         * @brief 添加图层绘制回调
+         *
+         * 回调在指定图层的所有实体绘制完毕之后、更高图层的实体绘制之前调用。
+         * @param layer 图层
+         * @param pass 绘制回调
+         */
+        void addLayerPass(int layer, LayerPass pass);
+
         /**
          * @brief 更新渲染系统
          *
@@ -25,6 +25,7 @@ void engine::ui::UIElement::update(float dt, engine::core::Context &context)
         else
         {
             it = children_.erase(it);
+            markRenderDirty();
         }
     }
 }
@@ -54,6 +55,7 @@ void engine::ui::UIElement::addChild(std::unique_ptr<UIElement> child, int order
             child->setOrderIndex(order_index);
         }
         children_.push_back(std::move(child));
+        markRenderDirty();
     }
 }
 
@@ -66,6 +68,7 @@ std::unique_ptr<engine::ui::UIElement> engine::ui::UIElement::removeChild(UIElem
         std::unique_ptr<UIElement> remove_child = std::move(*it);
         children_.erase(it);
         remove_child->setParent(nullptr);
+        markRenderDirty();
         return remove_child;
     }
     return nullptr;
@@ -83,6 +86,7 @@ std::unique_ptr<engine::ui::UIElement> engine::ui::UIElement::removeChildById(en
         std::unique_ptr<UIElement> removed_child = std::move(*it);
         children_.erase(it);
         removed_child->setParent(nullptr); // 清除父指针
+        markRenderDirty();
         return removed_child;              // 返回被移除的子元素（可以挂载到别处）
     }
     return nullptr; // 未找到子元素
@@ -95,6 +99,7 @@ void engine::ui::UIElement::removeAllChildren()
         child->setParent(nullptr);
     }
     children_.clear();
+    markRenderDirty();
 }
 
 engine::ui::UIElement *engine::ui::UIElement::getChildById(entt::id_type id) const
@@ -115,6 +120,7 @@ void engine::ui::UIElement::sortChildrenByOrderIndex()
 {
     std::stable_sort(children_.begin(), children_.end(), [](const std::unique_ptr<UIElement> &a, const std::unique_ptr<UIElement> &b)
                      { return a->getOrderIndex() < b->getOrderIndex(); });
+    markRenderDirty(); // 子元素的绘制顺序可能改变
 }
 
 engine::utils::Rect engine::ui::UIElement::getBounds() const
@@ -124,12 +130,77 @@ engine::utils::Rect engine::ui::UIElement::getBounds() const
 }
 
 glm::vec2 engine::ui::UIElement::getScreenPosition() const
+{
+    if (layout_dirty_)
+    {
+        screen_position_ = parent_ ? parent_->getScreenPosition() + position_ : position_;
+        layout_dirty_ = false;
+    }
+    return screen_position_;
+}
+
+void engine::ui::UIElement::setParent(UIElement *parent)
+{
+    parent_ = parent;
+    markLayoutDirty();
+}
+
+void engine::ui::UIElement::setPosition(const glm::vec2 &position)
+{
+    if (position == position_)
+        return;
+    position_ = position;
+    markLayoutDirty();
+    markParentRenderDirty();
+}
+
+void engine::ui::UIElement::setSize(const glm::vec2 &size)
+{
+    if (size == size_)
+        return;
+    size_ = size;
+    markRenderDirty();
+}
+
+void engine::ui::UIElement::setVisible(bool visible)
+{
+    if (visible == visible_)
+        return;
+    visible_ = visible;
+    markParentRenderDirty();
+}
+
+void engine::ui::UIElement::markRenderDirty()
+{
+    markParentRenderDirty();
+}
+
+void engine::ui::UIElement::invalidateRenderCache(bool device_reset)
+{
+    for (const auto &child : children_)
+    {
+        if (child)
+            child->invalidateRenderCache(device_reset);
+    }
+}
+
+void engine::ui::UIElement::markParentRenderDirty()
 {
     if (parent_)
+        parent_->markRenderDirty();
+}
+
+void engine::ui::UIElement::markLayoutDirty()
+{
+    // 元素计算坐标时会先计算祖先的坐标，所以已标记的元素其子元素也一定已标记，无需继续向下
+    if (layout_dirty_)
+        return;
+    layout_dirty_ = true;
+    for (const auto &child : children_)
     {
-        return parent_->getScreenPosition() + position_;
+        if (child)
+            child->markLayoutDirty();
     }
-    return position_;
 }
 
 bool engine::ui::UIElement::isPointInside(const glm::vec2 &point) const
@@ -24,6 +24,9 @@ namespace engine::ui
         UIElement *parent_ = nullptr;
         std::vector<std::unique_ptr<UIElement>> children_;
 
+        mutable glm::vec2 screen_position_{0.0f, 0.0f}; ///< @brief 缓存的屏幕（绝对）坐标
+        mutable bool layout_dirty_ = true;              ///< @brief 屏幕坐标是否需要重新计算（自身或祖先移动过）
+
     public:
         explicit UIElement(const glm::vec2 &position = {0.0f, 0.0f}, const glm::vec2 &size = {0.0f, 0.0f});
         virtual ~UIElement() = default;
@@ -51,17 +54,29 @@ namespace engine::ui
         UIElement *getChildById(entt::id_type id) const; ///< @brief 根据ID获取子元素
         entt::id_type getId() const { return id_; }      ///< @brief 获取自身的ID
 
-        void setSize(const glm::vec2 &size) { size_ = size; }
-        void setVisible(bool visible) { visible_ = visible; }
-        void setParent(UIElement *parent) { parent_ = parent; }
-        void setPosition(const glm::vec2 &position) { position_ = position; }
+        void setSize(const glm::vec2 &size);
+        void setVisible(bool visible);
+        void setParent(UIElement *parent);
+        void setPosition(const glm::vec2 &position);
         void setNeedRemove(bool need_remove) { need_remove_ = need_remove; }
         void setOrderIndex(int order_index) { order_index_ = order_index; } ///< @brief 设置元素的排序索引
         void setId(entt::id_type id) { id_ = id; }                          ///< @brief 设置元素的ID
 
         void sortChildrenByOrderIndex(); ///< @brief 根据order_index_排序子元素
         engine::utils::Rect getBounds() const;
-        glm::vec2 getScreenPosition() const;
+        glm::vec2 getScreenPosition() const; ///< @brief 获取屏幕坐标（缓存，只在自身或祖先移动后重新计算）
         bool isPointInside(const glm::vec2 &point) const;
+
+        /// @brief 标记自身的绘制内容发生变化（通知祖先中的缓存面板重新渲染）
+        virtual void markRenderDirty();
+        /// @brief 渲染目标内容丢失时调用（向下传递给所有子元素），缓存面板需要重新渲染
+        /// @param device_reset 渲染设备是否被重置（纹理需要重新创建）
+        virtual void invalidateRenderCache(bool device_reset);
+
+    protected:
+        /// @brief 标记自身及所有子元素的屏幕坐标需要重新计算
+        void markLayoutDirty();
+        /// @brief 通知父元素：子元素的绘制内容发生变化（自身移动/显隐不影响自身缓存的内容）
+        void markParentRenderDirty();
     };
 }
@@ -28,16 +28,32 @@ namespace engine::ui
         void render(engine::core::Context &context) override;
 
         const engine::render::Image &getImage() const { return image_; }
-        void setImage(engine::render::Image image) { image_ = std::move(image); }
+        void setImage(engine::render::Image image)
+        {
+            image_ = std::move(image);
+            markRenderDirty();
+        }
 
         std::string getTexturePath() const { return image_.getTexturePath(); }
         entt::id_type getTextureId() const { return image_.getTextureId(); }
-        void setTextureId(const std::string &texture_path) { image_.setTexture(texture_path); }
+        void setTextureId(const std::string &texture_path)
+        {
+            image_.setTexture(texture_path);
+            markRenderDirty();
+        }
 
         const std::optional<engine::utils::Rect> &getSourceRect() const { return image_.getSourceRect(); }
-        void setSourceRect(std::optional<engine::utils::Rect> source_rect) { image_.setSourceRect(std::move(source_rect)); }
+        void setSourceRect(std::optional<engine::utils::Rect> source_rect)
+        {
+            image_.setSourceRect(std::move(source_rect));
+            markRenderDirty();
+        }
 
         bool isFlipped() const { return image_.isFlipped(); }
-        void setFlipped(bool flipped) { image_.setFlipped(flipped); }
+        void setFlipped(bool flipped)
+        {
+            image_.setFlipped(flipped);
+            markRenderDirty();
+        }
     };
 }
\ No newline at end of file
@@ -25,13 +25,19 @@ void engine::ui::UIInteractive::addImage(entt::id_type name_id, engine::render::
     }
     // 添加图片 (如果name_id已存在，则替换)
     images_.insert_or_assign(name_id, std::move(image));
+    if (name_id == current_image_id_)
+        markRenderDirty();
 }
 
 void engine::ui::UIInteractive::setCurrentImage(entt::id_type name_id)
 {
     if (images_.find(name_id) != images_.end())
     {
-        current_image_id_ = name_id;
+        if (current_image_id_ != name_id)
+        {
+            current_image_id_ = name_id;
+            markRenderDirty(); // 悬停/按下等状态切换时通知缓存面板
+        }
     }
     else
     {
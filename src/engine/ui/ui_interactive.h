@@ -2,6 +2,7 @@
 #include "ui_element.h"
 #include "state/ui_state.h"
 #include "../render/image.h"
+#include "../utils/small_flat_map.h"
 #include <unordered_map>
 #include <memory>
 #include <entt/entity/fwd.hpp>
@@ -19,7 +20,7 @@ namespace engine::ui
         std::unique_ptr<engine::ui::state::UIState> state_;
         std::unique_ptr<engine::ui::state::UIState> next_state_;          ///< @brief 下一个状态，用于处理状态切换
         std::unordered_map<entt::id_type, engine::render::Image> images_; ///< @brief 图片集合
-        std::unordered_map<entt::id_type, entt::id_type> sounds_;
+        engine::utils::SmallFlatMap<entt::id_type, entt::id_type> sounds_; ///< @brief 音效集合（通常只有悬停、点击两个）
         entt::id_type current_image_id_ = entt::null; ///< @brief 当前显示的图片ID
         bool interactive_ = true;
 
@@ -28,8 +28,11 @@ void engine::ui::UILabel::render(engine::core::Context &context)
 
 void engine::ui::UILabel::setText(const std::string &text)
 {
+    if (text == text_)
+        return;
     text_ = text;
     size_ = text_renderer_.getTextSize(text_, font_id_, font_size_, font_path_);
+    markRenderDirty();
 }
 
 void engine::ui::UILabel::setFontPath(const std::string &font_path)
@@ -37,15 +40,18 @@ void engine::ui::UILabel::setFontPath(const std::string &font_path)
     font_path_ = font_path;
     font_id_ = entt::hashed_string(font_path.data());
     size_ = text_renderer_.getTextSize(text_, font_id_, font_size_, font_path_);
+    markRenderDirty();
 }
 
 void engine::ui::UILabel::setFontSize(int font_size)
 {
     font_size_ = font_size;
     size_ = text_renderer_.getTextSize(text_, font_id_, font_size_, font_path_);
+    markRenderDirty();
 }
 
 void engine::ui::UILabel::setTextFColor(engine::utils::FColor text_fcolor)
 {
     text_fcolor_ = std::move(text_fcolor);
+    markRenderDirty();
 }
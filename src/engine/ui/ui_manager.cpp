@@ -42,6 +42,14 @@ void engine::ui::UIManager::clearElements()
     }
 }
 
+void engine::ui::UIManager::invalidateRenderCache(bool device_reset)
+{
+    if (root_element_)
+    {
+        root_element_->invalidateRenderCache(device_reset);
+    }
+}
+
 void engine::ui::UIManager::update(float dt, engine::core::Context &context)
 {
     if (root_element_ && root_element_->isVisible())
@@ -33,6 +33,7 @@ namespace engine::ui
         void addElement(std::unique_ptr<engine::ui::UIElement> element);
         UIPanel *getRootElement() const;
         void clearElements();
+        void invalidateRenderCache(bool device_reset); ///< @brief 渲染目标内容丢失时，使所有缓存面板重新渲染
 
         // --- 核心循环方法 ---
         void update(float delta_time, engine::core::Context &); ///< @brief 更新UI元素。
@@ -1,7 +1,9 @@
 #include "ui_panel.h"
 #include "../core/context.h"
 #include "../render/render.h"
+#include "../render/text_renderer.h"
 #include <SDL3/SDL_rect.h>
+#include <SDL3/SDL_render.h>
 #include <spdlog/spdlog.h>
 engine::ui::UIPanel::UIPanel(const glm::vec2 &position, const glm::vec2 &size, std::optional<engine::utils::FColor> background_color)
     : UIElement(position, size), background_color_(background_color)
@@ -9,15 +11,105 @@ engine::ui::UIPanel::UIPanel(const glm::vec2 &position, const glm::vec2 &size, s
     spdlog::info("UIPanel created");
 }
 
+engine::ui::UIPanel::~UIPanel() = default;
+
+void engine::ui::UIPanel::SDLTextureDeleter::operator()(SDL_Texture *texture) const
+{
+    if (texture)
+    {
+        SDL_DestroyTexture(texture);
+    }
+}
+
+void engine::ui::UIPanel::setBackgroundColor(const std::optional<engine::utils::FColor> &background_color)
+{
+    background_color_ = background_color;
+    markRenderDirty();
+}
+
+void engine::ui::UIPanel::setCached(bool cached)
+{
+    cached_ = cached;
+    cache_dirty_ = true;
+    if (!cached_)
+    {
+        cache_texture_.reset();
+    }
+}
+
+void engine::ui::UIPanel::markRenderDirty()
+{
+    cache_dirty_ = true;
+    // 外层的缓存面板也包含了本面板的内容，继续向上通知
+    UIElement::markRenderDirty();
+}
+
+void engine::ui::UIPanel::invalidateRenderCache(bool device_reset)
+{
+    cache_dirty_ = true;
+    if (device_reset)
+    {
+        // 设备重置后旧纹理不可再用，下次渲染时重新创建
+        cache_texture_.reset();
+    }
+    UIElement::invalidateRenderCache(device_reset);
+}
+
 void engine::ui::UIPanel::render(engine::core::Context &context)
 {
     if (!visible_)
     {
         return;
     }
+    if (cached_ && (!cache_dirty_ || updateCache(context)))
+    {
+        // 缓存有效时整个面板只绘制一次纹理
+        context.getRender().drawUITexture(cache_texture_.get(), getScreenPosition(), cache_size_);
+        return;
+    }
+    renderContent(context);
+}
+
+void engine::ui::UIPanel::renderContent(engine::core::Context &context)
+{
     if (background_color_)
     {
         context.getRender().drawUIFillRect(getBounds(), background_color_.value());
     }
     UIElement::render(context);
 }
+
+bool engine::ui::UIPanel::updateCache(engine::core::Context &context)
+{
+    auto &renderer = context.getRender();
+    auto &text_renderer = context.getTextRenderer();
+    // 面板尺寸变化时重新创建纹理
+    if (!cache_texture_ || cache_size_ != size_)
+    {
+        cache_texture_.reset(renderer.createRenderTarget(size_));
+        cache_size_ = size_;
+        if (!cache_texture_)
+        {
+            spdlog::warn("UIPanel cache disabled, fall back to direct rendering");
+            cached_ = false;
+            return false;
+        }
+    }
+
+    // 以面板的屏幕坐标为原点渲染子树（面板移动时不需要重新渲染）
+    const auto origin = getScreenPosition();
+    auto previous = renderer.pushRenderTarget(cache_texture_.get(), origin);
+    if (!previous)
+    {
+        return false;
+    }
+    const auto previous_text_origin = text_renderer.getUIOrigin();
+    text_renderer.setUIOrigin(origin);
+    renderContent(context);
+    text_renderer.setUIOrigin(previous_text_origin);
+    renderer.popRenderTarget(previous.value());
+
+    cache_dirty_ = false;
+    ++cache_renders_;
+    return true;
+}
@@ -1,21 +1,52 @@
 #pragma once
 #include "ui_element.h"
+#include <memory>
 #include <optional>
 #include "../utils/math.h"
 
+struct SDL_Texture;
+
 namespace engine::ui
 {
 
+    /**
+     * @brief UI面板，可选择绘制背景色
+     *
+     * 可开启缓存模式（setCached）：整个子树渲染到一张纹理中，之后每帧只绘制这张纹理，
+     * 直到子元素的绘制内容发生变化（显隐、移动、文字、悬停状态等，见 UIElement::markRenderDirty）时才重新渲染。
+     * 适用于大部分时间不变的面板；子元素必须位于面板范围内（超出部分会被裁剪）。
+     */
     class UIPanel final : public UIElement
     {
+        struct SDLTextureDeleter
+        {
+            void operator()(SDL_Texture *texture) const;
+        };
+
         std::optional<engine::utils::FColor> background_color_;
 
+        bool cached_ = false;                                           ///< @brief 是否开启缓存模式
+        bool cache_dirty_ = true;                                       ///< @brief 缓存纹理是否需要重新渲染
+        glm::vec2 cache_size_{0.0f, 0.0f};                              ///< @brief 缓存纹理对应的面板尺寸
+        std::unique_ptr<SDL_Texture, SDLTextureDeleter> cache_texture_; ///< @brief 缓存纹理
+        size_t cache_renders_ = 0;                                      ///< @brief 缓存纹理重新渲染的次数
+
     public:
         UIPanel(const glm::vec2 &position = {0.0f, 0.0f}, const glm::vec2 &size = {0.0f, 0.0f}, std::optional<engine::utils::FColor> background_color = std::nullopt);
-        void setBackgroundColor(const std::optional<engine::utils::FColor> &background_color) { background_color_ = background_color; }
+        void setBackgroundColor(const std::optional<engine::utils::FColor> &background_color);
         const std::optional<engine::utils::FColor> &getBackgroundColor() const { return background_color_; }
         void render(engine::core::Context &context) override;
-        virtual ~UIPanel() = default;
+        ~UIPanel() override;
+
+        void setCached(bool cached); ///< @brief 开启/关闭缓存模式
+        bool isCached() const { return cached_; }
+        size_t getCacheRenders() const { return cache_renders_; }
+        void markRenderDirty() override;
+        void invalidateRenderCache(bool device_reset) override;
+
+    private:
+        void renderContent(engine::core::Context &context); ///< @brief 直接绘制背景色与子元素
+        bool updateCache(engine::core::Context &context);   ///< @brief 将背景色与子元素渲染到缓存纹理，失败返回false
     };
 
 }
@@ -0,0 +1,164 @@
+#include "alloc_tracker.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <mutex>
+
+namespace engine::utils
+{
+    namespace
+    {
+        /// @brief 作用域计数（可能被任意线程的 operator new 修改）
+        struct ScopeCounters
+        {
+            std::atomic<size_t> count_{0};
+            std::atomic<size_t> bytes_{0};
+        };
+
+        // 以下全局变量都是常量初始化的，程序启动前（静态初始化期间）的分配也可以安全记录
+        std::array<ScopeCounters, AllocTracker::MAX_SCOPES> g_counters;
+        std::array<AllocScopeStats, AllocTracker::MAX_SCOPES> g_stats{{{"other"}}};
+        std::atomic<size_t> g_scope_count{1}; ///< @brief 已登记的作用域数量（0号为 "other"）
+        std::mutex g_register_mutex;
+        size_t g_frame_count{0};
+        size_t g_frame_bytes{0};
+        thread_local uint16_t t_current_scope{0};
+    }
+
+    uint16_t AllocTracker::registerScope(const char *name)
+    {
+        std::lock_guard lock(g_register_mutex);
+        const size_t count = g_scope_count.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (std::strcmp(g_stats[i].name_, name) == 0)
+                return static_cast<uint16_t>(i);
+        }
+        if (count >= MAX_SCOPES)
+            return 0;
+        g_stats[count].name_ = name;
+        g_scope_count.store(count + 1, std::memory_order_release);
+        return static_cast<uint16_t>(count);
+    }
+
+    uint16_t AllocTracker::enterScope(uint16_t scope)
+    {
+        const auto previous = t_current_scope;
+        t_current_scope = scope;
+        return previous;
+    }
+
+    void AllocTracker::leaveScope(uint16_t previous)
+    {
+        t_current_scope = previous;
+    }
+
+    void AllocTracker::record(size_t bytes)
+    {
+        auto &counters = g_counters[t_current_scope];
+        counters.count_.fetch_add(1, std::memory_order_relaxed);
+        counters.bytes_.fetch_add(bytes, std::memory_order_relaxed);
+    }
+
+    void AllocTracker::endFrame()
+    {
+        g_frame_count = 0;
+        g_frame_bytes = 0;
+        const size_t count = g_scope_count.load(std::memory_order_acquire);
+        for (size_t i = 0; i < count; ++i)
+        {
+            auto &stats = g_stats[i];
+            stats.count_ = g_counters[i].count_.exchange(0, std::memory_order_relaxed);
+            stats.bytes_ = g_counters[i].bytes_.exchange(0, std::memory_order_relaxed);
+            stats.peak_count_ = std::max(stats.peak_count_, stats.count_);
+            stats.total_count_ += stats.count_;
+            g_frame_count += stats.count_;
+            g_frame_bytes += stats.bytes_;
+        }
+    }
+
+    size_t AllocTracker::getFrameCount() { return g_frame_count; }
+    size_t AllocTracker::getFrameBytes() { return g_frame_bytes; }
+    size_t AllocTracker::getScopeCount() { return g_scope_count.load(std::memory_order_acquire); }
+    const AllocScopeStats &AllocTracker::getScopeStats(size_t scope) { return g_stats[scope]; }
+
+    void AllocTracker::resetStats()
+    {
+        const size_t count = g_scope_count.load(std::memory_order_acquire);
+        for (size_t i = 0; i < count; ++i)
+        {
+            g_stats[i].peak_count_ = 0;
+            g_stats[i].total_count_ = 0;
+        }
+    }
+
+}
+
+#ifdef MW_TRACK_ALLOCATIONS
+// --- 替换全局 operator new/delete（只统计分配，释放直接交给C运行库） ---
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    void *trackedAlloc(size_t size)
+    {
+        engine::utils::AllocTracker::record(size);
+        return std::malloc(size == 0 ? 1 : size);
+    }
+
+    void *trackedAlignedAlloc(size_t size, size_t alignment)
+    {
+        engine::utils::AllocTracker::record(size);
+        if (size == 0)
+            size = 1;
+#ifdef _WIN32
+        return _aligned_malloc(size, alignment);
+#else
+        void *ptr = nullptr;
+        if (posix_memalign(&ptr, alignment < sizeof(void *) ? sizeof(void *) : alignment, size) != 0)
+            return nullptr;
+        return ptr;
+#endif
+    }
+
+    void alignedFree(void *ptr)
+    {
+#ifdef _WIN32
+        _aligned_free(ptr);
+#else
+        std::free(ptr);
+#endif
+    }
+
+    void *allocOrThrow(void *ptr)
+    {
+        if (!ptr)
+            throw std::bad_alloc();
+        return ptr;
+    }
+}
+
+void *operator new(size_t size) { return allocOrThrow(trackedAlloc(size)); }
+void *operator new[](size_t size) { return allocOrThrow(trackedAlloc(size)); }
+void *operator new(size_t size, const std::nothrow_t &) noexcept { return trackedAlloc(size); }
+void *operator new[](size_t size, const std::nothrow_t &) noexcept { return trackedAlloc(size); }
+void *operator new(size_t size, std::align_val_t alignment) { return allocOrThrow(trackedAlignedAlloc(size, static_cast<size_t>(alignment))); }
+void *operator new[](size_t size, std::align_val_t alignment) { return allocOrThrow(trackedAlignedAlloc(size, static_cast<size_t>(alignment))); }
+void *operator new(size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept { return trackedAlignedAlloc(size, static_cast<size_t>(alignment)); }
+void *operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept { return trackedAlignedAlloc(size, static_cast<size_t>(alignment)); }
+
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+void operator delete[](void *ptr) noexcept { std::free(ptr); }
+void operator delete(void *ptr, size_t) noexcept { std::free(ptr); }
+void operator delete[](void *ptr, size_t) noexcept { std::free(ptr); }
+void operator delete(void *ptr, const std::nothrow_t &) noexcept { std::free(ptr); }
+void operator delete[](void *ptr, const std::nothrow_t &) noexcept { std::free(ptr); }
+void operator delete(void *ptr, std::align_val_t) noexcept { alignedFree(ptr); }
+void operator delete[](void *ptr, std::align_val_t) noexcept { alignedFree(ptr); }
+void operator delete(void *ptr, size_t, std::align_val_t) noexcept { alignedFree(ptr); }
+void operator delete[](void *ptr, size_t, std::align_val_t) noexcept { alignedFree(ptr); }
+void operator delete(void *ptr, std::align_val_t, const std::nothrow_t &) noexcept { alignedFree(ptr); }
+void operator delete[](void *ptr, std::align_val_t, const std::nothrow_t &) noexcept { alignedFree(ptr); }
+#endif
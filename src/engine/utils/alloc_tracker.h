@@ -0,0 +1,86 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace engine::utils
+{
+
+    /// @brief 单个作用域的分配统计
+    struct AllocScopeStats
+    {
+        const char *name_{nullptr}; ///< @brief 作用域名称（通常是系统名称）
+        size_t count_{0};           ///< @brief 上一帧的分配次数
+        size_t bytes_{0};           ///< @brief 上一帧分配的字节数
+        size_t peak_count_{0};      ///< @brief 单帧分配次数的最大值
+        size_t total_count_{0};     ///< @brief 累计分配次数
+    };
+
+    /**
+     * @brief 全局分配统计（可选功能，CMake 选项 MW_TRACK_ALLOCATIONS 开启）
+     *
+     * 开启后替换全局 operator new/delete，把每次堆分配记到当前线程的“分配作用域”上。
+     * 作用域用 MW_ALLOC_SCOPE("名称") 声明（RAII，离开代码块时恢复上一层作用域），
+     * 不在任何作用域内的分配记到 "other"。每帧结束时调用 endFrame() 保存本帧统计。
+     * 未开启时宏为空，所有统计均为0，不产生任何开销。
+     */
+    class AllocTracker final
+    {
+    public:
+        static constexpr size_t MAX_SCOPES = 64; ///< @brief 作用域数量上限（超出的记到 "other"）
+
+#ifdef MW_TRACK_ALLOCATIONS
+        static constexpr bool ENABLED = true;
+#else
+        static constexpr bool ENABLED = false;
+#endif
+
+        AllocTracker() = delete;
+
+        /// @brief 登记作用域（同名返回相同ID），返回作用域ID
+        static uint16_t registerScope(const char *name);
+
+        /// @brief 设置当前线程的作用域，返回之前的作用域
+        static uint16_t enterScope(uint16_t scope);
+        static void leaveScope(uint16_t previous);
+
+        /// @brief 记录一次分配（由 operator new 调用）
+        static void record(size_t bytes);
+
+        /// @brief 结束当前帧：保存各作用域的本帧统计并清零
+        static void endFrame();
+
+        /// @brief 上一帧的总分配次数与字节数
+        static size_t getFrameCount();
+        static size_t getFrameBytes();
+
+        static size_t getScopeCount();
+        static const AllocScopeStats &getScopeStats(size_t scope);
+        static void resetStats();
+    };
+
+    /// @brief 分配作用域守卫
+    class AllocScope final
+    {
+        uint16_t previous_;
+
+    public:
+        explicit AllocScope(uint16_t scope) : previous_(AllocTracker::enterScope(scope)) {}
+        ~AllocScope() { AllocTracker::leaveScope(previous_); }
+
+        AllocScope(const AllocScope &) = delete;
+        AllocScope &operator=(const AllocScope &) = delete;
+    };
+
+}
+
+#define MW_ALLOC_CONCAT_IMPL(a, b) a##b
+#define MW_ALLOC_CONCAT(a, b) MW_ALLOC_CONCAT_IMPL(a, b)
+
+#ifdef MW_TRACK_ALLOCATIONS
+/// @brief 声明分配作用域，直到所在代码块结束
+#define MW_ALLOC_SCOPE(name)                                                                                                  \
+    static const uint16_t MW_ALLOC_CONCAT(mw_alloc_scope_id_, __LINE__) = engine::utils::AllocTracker::registerScope(name); \
+    const engine::utils::AllocScope MW_ALLOC_CONCAT(mw_alloc_scope_, __LINE__)(MW_ALLOC_CONCAT(mw_alloc_scope_id_, __LINE__))
+#else
+#define MW_ALLOC_SCOPE(name) (void)0
+#endif
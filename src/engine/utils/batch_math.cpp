@@ -0,0 +1,233 @@
+#include "batch_math.h"
+#include <bit>
+
+// MW_BATCH_FORCE_SCALAR：强制使用标量实现（用于基准测试对比）
+#if defined(MW_BATCH_FORCE_SCALAR)
+#elif defined(__AVX2__)
+#include <immintrin.h>
+#define MW_BATCH_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define MW_BATCH_SSE2
+#endif
+
+namespace engine::utils
+{
+    namespace
+    {
+        constexpr float PI = 3.14159265358979323846f;
+
+        // sin(t * PI) = cos(PI * (t - 0.5))，在 [-PI/2, PI/2] 内用泰勒多项式（到10次项）近似
+        constexpr float C1 = -1.0f / 2.0f;
+        constexpr float C2 = 1.0f / 24.0f;
+        constexpr float C3 = -1.0f / 720.0f;
+        constexpr float C4 = 1.0f / 40320.0f;
+        constexpr float C5 = -1.0f / 3628800.0f;
+
+        inline float clamp01(float t)
+        {
+            return t < 0.0f ? 0.0f : (t > 1.0f ? 1.0f : t);
+        }
+
+        inline float sinPiUnit(float t)
+        {
+            float x = (t - 0.5f) * PI;
+            float z = x * x;
+            return 1.0f + z * (C1 + z * (C2 + z * (C3 + z * (C4 + z * C5))));
+        }
+
+        // --- 标量实现（同时用于处理剩余元素） ---
+        void integrateScalar(float *pos_x, float *pos_y, const float *vel_x, const float *vel_y, size_t begin, size_t end, float dt)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                pos_x[i] += vel_x[i] * dt;
+                pos_y[i] += vel_y[i] * dt;
+            }
+        }
+
+        void lerpArcScalar(const float *sx, const float *sy, const float *tx, const float *ty,
+                           const float *t, const float *arc, float *out_x, float *out_y, size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                float p = clamp01(t[i]);
+                out_x[i] = sx[i] + (tx[i] - sx[i]) * p;
+                out_y[i] = sy[i] + (ty[i] - sy[i]) * p - sinPiUnit(p) * arc[i];
+            }
+        }
+
+        inline bool inRadius(const glm::vec2 &center, float radius_sq, float x, float y, bool inclusive = true)
+        {
+            float dx = x - center.x;
+            float dy = y - center.y;
+            float dist_sq = dx * dx + dy * dy;
+            return inclusive ? dist_sq <= radius_sq : dist_sq < radius_sq;
+        }
+
+#if defined(MW_BATCH_AVX2)
+        constexpr size_t WIDTH = 8;
+        using VecF = __m256;
+        inline VecF load(const float *p) { return _mm256_loadu_ps(p); }
+        inline void store(float *p, VecF v) { _mm256_storeu_ps(p, v); }
+        inline VecF set1(float v) { return _mm256_set1_ps(v); }
+        inline VecF add(VecF a, VecF b) { return _mm256_add_ps(a, b); }
+        inline VecF sub(VecF a, VecF b) { return _mm256_sub_ps(a, b); }
+        inline VecF mul(VecF a, VecF b) { return _mm256_mul_ps(a, b); }
+        inline VecF vmin(VecF a, VecF b) { return _mm256_min_ps(a, b); }
+        inline VecF vmax(VecF a, VecF b) { return _mm256_max_ps(a, b); }
+        inline unsigned maskLessEqual(VecF a, VecF b) { return static_cast<unsigned>(_mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_LE_OQ))); }
+        inline unsigned maskLess(VecF a, VecF b) { return static_cast<unsigned>(_mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_LT_OQ))); }
+#elif defined(MW_BATCH_SSE2)
+        constexpr size_t WIDTH = 4;
+        using VecF = __m128;
+        inline VecF load(const float *p) { return _mm_loadu_ps(p); }
+        inline void store(float *p, VecF v) { _mm_storeu_ps(p, v); }
+        inline VecF set1(float v) { return _mm_set1_ps(v); }
+        inline VecF add(VecF a, VecF b) { return _mm_add_ps(a, b); }
+        inline VecF sub(VecF a, VecF b) { return _mm_sub_ps(a, b); }
+        inline VecF mul(VecF a, VecF b) { return _mm_mul_ps(a, b); }
+        inline VecF vmin(VecF a, VecF b) { return _mm_min_ps(a, b); }
+        inline VecF vmax(VecF a, VecF b) { return _mm_max_ps(a, b); }
+        inline unsigned maskLessEqual(VecF a, VecF b) { return static_cast<unsigned>(_mm_movemask_ps(_mm_cmple_ps(a, b))); }
+        inline unsigned maskLess(VecF a, VecF b) { return static_cast<unsigned>(_mm_movemask_ps(_mm_cmplt_ps(a, b))); }
+#endif
+    }
+
+    const char *batchMathBackend()
+    {
+#if defined(MW_BATCH_AVX2)
+        return "AVX2";
+#elif defined(MW_BATCH_SSE2)
+        return "SSE2";
+#else
+        return "Scalar";
+#endif
+    }
+
+#if defined(MW_BATCH_AVX2) || defined(MW_BATCH_SSE2)
+
+    void integrateBatch(float *pos_x, float *pos_y, const float *vel_x, const float *vel_y, size_t count, float delta_time)
+    {
+        const VecF dt = set1(delta_time);
+        size_t i = 0;
+        for (; i + WIDTH <= count; i += WIDTH)
+        {
+            store(pos_x + i, add(load(pos_x + i), mul(load(vel_x + i), dt)));
+            store(pos_y + i, add(load(pos_y + i), mul(load(vel_y + i), dt)));
+        }
+        integrateScalar(pos_x, pos_y, vel_x, vel_y, i, count, delta_time);
+    }
+
+    void lerpArcBatch(const float *start_x, const float *start_y,
+                      const float *target_x, const float *target_y,
+                      const float *t, const float *arc_height,
+                      float *out_x, float *out_y, size_t count)
+    {
+        const VecF zero = set1(0.0f), one = set1(1.0f), half = set1(0.5f), pi = set1(PI);
+        const VecF c1 = set1(C1), c2 = set1(C2), c3 = set1(C3), c4 = set1(C4), c5 = set1(C5);
+        size_t i = 0;
+        for (; i + WIDTH <= count; i += WIDTH)
+        {
+            VecF p = vmin(vmax(load(t + i), zero), one);
+            VecF sx = load(start_x + i), sy = load(start_y + i);
+            VecF x = add(sx, mul(sub(load(target_x + i), sx), p));
+            VecF y = add(sy, mul(sub(load(target_y + i), sy), p));
+
+            VecF a = mul(sub(p, half), pi);
+            VecF z = mul(a, a);
+            VecF s = add(c4, mul(z, c5));
+            s = add(c3, mul(z, s));
+            s = add(c2, mul(z, s));
+            s = add(c1, mul(z, s));
+            s = add(one, mul(z, s));
+
+            store(out_x + i, x);
+            store(out_y + i, sub(y, mul(s, load(arc_height + i))));
+        }
+        lerpArcScalar(start_x, start_y, target_x, target_y, t, arc_height, out_x, out_y, i, count);
+    }
+
+    size_t radiusTestMany(const glm::vec2 &center, float radius_sq, const float *xs, const float *ys, size_t count, uint32_t *out_indices, bool inclusive)
+    {
+        const VecF cx = set1(center.x), cy = set1(center.y), r2 = set1(radius_sq);
+        size_t hits = 0;
+        size_t i = 0;
+        for (; i + WIDTH <= count; i += WIDTH)
+        {
+            VecF dx = sub(load(xs + i), cx);
+            VecF dy = sub(load(ys + i), cy);
+            VecF dist_sq = add(mul(dx, dx), mul(dy, dy));
+            unsigned mask = inclusive ? maskLessEqual(dist_sq, r2) : maskLess(dist_sq, r2);
+            while (mask != 0) // 按位取出命中的索引（从低位到高位，保持升序）
+            {
+                out_indices[hits++] = static_cast<uint32_t>(i + std::countr_zero(mask));
+                mask &= mask - 1;
+            }
+        }
+        for (; i < count; ++i)
+        {
+            if (inRadius(center, radius_sq, xs[i], ys[i], inclusive))
+                out_indices[hits++] = static_cast<uint32_t>(i);
+        }
+        return hits;
+    }
+
+    size_t findFirstInRadius(const glm::vec2 &center, float radius_sq, const float *xs, const float *ys, size_t count)
+    {
+        const VecF cx = set1(center.x), cy = set1(center.y), r2 = set1(radius_sq);
+        size_t i = 0;
+        for (; i + WIDTH <= count; i += WIDTH)
+        {
+            VecF dx = sub(load(xs + i), cx);
+            VecF dy = sub(load(ys + i), cy);
+            if (unsigned mask = maskLessEqual(add(mul(dx, dx), mul(dy, dy)), r2); mask != 0)
+                return i + std::countr_zero(mask);
+        }
+        for (; i < count; ++i)
+        {
+            if (inRadius(center, radius_sq, xs[i], ys[i]))
+                return i;
+        }
+        return count;
+    }
+
+#else // 标量实现
+
+    void integrateBatch(float *pos_x, float *pos_y, const float *vel_x, const float *vel_y, size_t count, float delta_time)
+    {
+        integrateScalar(pos_x, pos_y, vel_x, vel_y, 0, count, delta_time);
+    }
+
+    void lerpArcBatch(const float *start_x, const float *start_y,
+                      const float *target_x, const float *target_y,
+                      const float *t, const float *arc_height,
+                      float *out_x, float *out_y, size_t count)
+    {
+        lerpArcScalar(start_x, start_y, target_x, target_y, t, arc_height, out_x, out_y, 0, count);
+    }
+
+    size_t radiusTestMany(const glm::vec2 &center, float radius_sq, const float *xs, const float *ys, size_t count, uint32_t *out_indices, bool inclusive)
+    {
+        size_t hits = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (inRadius(center, radius_sq, xs[i], ys[i], inclusive))
+                out_indices[hits++] = static_cast<uint32_t>(i);
+        }
+        return hits;
+    }
+
+    size_t findFirstInRadius(const glm::vec2 &center, float radius_sq, const float *xs, const float *ys, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (inRadius(center, radius_sq, xs[i], ys[i]))
+                return i;
+        }
+        return count;
+    }
+
+#endif
+
+}
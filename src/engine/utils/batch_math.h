@@ -0,0 +1,79 @@
+#pragma once
+#include <glm/vec2.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace engine::utils
+{
+
+    /**
+     * @brief 二维点的SoA（结构数组）缓冲区，x 与 y 分别连续存放，供批量数学函数使用
+     * @note 只用作每帧的临时数据（clear后重新填充），vector容量会保留，不会每帧重新分配
+     */
+    struct Vec2SoA
+    {
+        std::vector<float> x;
+        std::vector<float> y;
+
+        void clear()
+        {
+            x.clear();
+            y.clear();
+        }
+        void reserve(size_t count)
+        {
+            x.reserve(count);
+            y.reserve(count);
+        }
+        void push(const glm::vec2 &point)
+        {
+            x.push_back(point.x);
+            y.push_back(point.y);
+        }
+        glm::vec2 get(size_t index) const { return {x[index], y[index]}; }
+        size_t size() const { return x.size(); }
+        bool empty() const { return x.empty(); }
+    };
+
+    // --- 批量数学函数（SoA） ---
+    // 编译时根据指令集选择实现：定义了 __AVX2__ 时每次处理8个，SSE2（x86-64默认）每次处理4个，
+    // 其他平台（或定义了 MW_BATCH_FORCE_SCALAR）使用标量实现。剩余不足一组的元素总是用标量处理，各实现之间只有浮点舍入误差。
+
+    /// @brief 当前使用的批量数学实现名称（"AVX2" / "SSE2" / "Scalar"）
+    const char *batchMathBackend();
+
+    /**
+     * @brief 批量积分：position += velocity * delta_time
+     * @param pos_x, pos_y 位置（输入输出）
+     * @param vel_x, vel_y 速度
+     * @param count 元素数量
+     * @param delta_time 时间步长
+     * @note 只在数据本来就以SoA存放时才有收益；先从组件(AoS)收集再写回反而更慢（见 mw-bench-batch-math），
+     *       因此 MovementSystem 直接遍历 owning group
+     */
+    void integrateBatch(float *pos_x, float *pos_y, const float *vel_x, const float *vel_y, size_t count, float delta_time);
+
+    /**
+     * @brief 批量计算抛物线弧形轨迹：out = mix(start, target, t)，且 y 减去 sin(t * PI) * arc_height
+     * @param t 飞行进度，内部会限制在 [0, 1]
+     * @param out_x, out_y 输出位置
+     * @note sin 使用多项式近似（t在 [0, 1] 内误差小于1e-6），与 glm::sin 的结果几乎相同
+     */
+    void lerpArcBatch(const float *start_x, const float *start_y,
+                      const float *target_x, const float *target_y,
+                      const float *t, const float *arc_height,
+                      float *out_x, float *out_y, size_t count);
+
+    /**
+     * @brief 批量半径检测：找出所有与中心点距离的平方 <= radius_sq（inclusive 为 false 时为 <）的点
+     * @param out_indices 输出命中的索引（按升序），容量至少为 count
+     * @param inclusive 恰好位于边界上的点是否算作命中
+     * @return 命中数量
+     */
+    size_t radiusTestMany(const glm::vec2 &center, float radius_sq, const float *xs, const float *ys, size_t count, uint32_t *out_indices, bool inclusive = true);
+
+    /// @brief 找出第一个与中心点距离的平方 <= radius_sq 的点，没有则返回 count
+    size_t findFirstInRadius(const glm::vec2 &center, float radius_sq, const float *xs, const float *ys, size_t count);
+
+}
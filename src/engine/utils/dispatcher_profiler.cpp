@@ -0,0 +1,168 @@
+#include "dispatcher_profiler.h"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+
+namespace engine::utils
+{
+
+    DispatcherProfiler::DispatcherProfiler(entt::dispatcher &dispatcher)
+        : dispatcher_(dispatcher) {}
+
+    DispatcherProfiler::~DispatcherProfiler()
+    {
+        for (auto &channel : channels_)
+        {
+            dispatcher_.disconnect(channel->stats_);
+        }
+    }
+
+    void DispatcherProfiler::update()
+    {
+        using clock = std::chrono::steady_clock;
+        const auto frame_start = clock::now();
+
+        // 1. 逐类型分发登记的事件，记录队列长度与处理耗时
+        for (auto &channel : channels_)
+        {
+            flushChannel(*channel);
+        }
+
+        // 2. 分发其余（未登记类型）的事件
+        dispatcher_.update();
+
+        // 3. 结束当前帧：保存本帧统计并清零
+        for (auto &channel : channels_)
+        {
+            auto &stats = channel->stats_;
+            stats.count_ = stats.frame_count_;
+            stats.queued_ = stats.frame_queued_;
+            stats.handler_ms_ = stats.frame_ms_;
+            stats.peak_count_ = std::max(stats.peak_count_, stats.count_);
+            stats.peak_queued_ = std::max(stats.peak_queued_, stats.queued_);
+            stats.peak_handler_ms_ = std::max(stats.peak_handler_ms_, stats.handler_ms_);
+            stats.total_ += stats.count_;
+            stats.frame_count_ = 0;
+            stats.frame_queued_ = 0;
+            stats.frame_ms_ = 0.0;
+        }
+        for (auto &phase : phases_)
+        {
+            auto &stats = phase.stats_;
+            stats.processed_ = stats.frame_processed_;
+            stats.deferred_ = stats.frame_deferred_;
+            stats.frame_processed_ = 0;
+            stats.frame_deferred_ = 0;
+        }
+        frame_ms_ = std::chrono::duration<double, std::milli>(clock::now() - frame_start).count();
+        ++frames_;
+    }
+
+    size_t DispatcherProfiler::flush(entt::id_type phase_id)
+    {
+        auto *phase = findPhase(phase_id);
+        if (!phase)
+            return 0;
+
+        auto &stats = phase->stats_;
+        size_t processed = 0;
+        // 处理函数可能产生同一阶段的新事件（例如 动画事件 -> 攻击事件），循环直到队列清空或达到预算
+        bool has_pending = true;
+        while (has_pending && processed < stats.budget_)
+        {
+            for (auto *channel : phase->channels_)
+            {
+                if (processed >= stats.budget_)
+                    break;
+                processed += flushChannel(*channel);
+            }
+            has_pending = std::any_of(phase->channels_.begin(), phase->channels_.end(), [](const Channel *channel)
+                                      { return channel->pending_() > 0; });
+        }
+
+        stats.frame_processed_ += processed;
+        if (has_pending)
+        {
+            for (const auto *channel : phase->channels_)
+            {
+                stats.frame_deferred_ += channel->pending_();
+            }
+        }
+        return processed;
+    }
+
+    void DispatcherProfiler::setPhaseBudget(entt::id_type phase_id, size_t budget)
+    {
+        if (auto *phase = findPhase(phase_id))
+        {
+            phase->stats_.budget_ = budget;
+        }
+    }
+
+    size_t DispatcherProfiler::flushChannel(Channel &channel)
+    {
+        auto &stats = channel.stats_;
+        const size_t pending = channel.pending_();
+        if (pending == 0)
+            return 0;
+        stats.frame_queued_ = std::max(stats.frame_queued_, pending);
+        const auto start = std::chrono::steady_clock::now();
+        channel.flush_();
+        stats.frame_ms_ += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        return pending;
+    }
+
+    DispatcherProfiler::Phase *DispatcherProfiler::findPhase(entt::id_type phase_id)
+    {
+        auto it = std::find_if(phases_.begin(), phases_.end(), [phase_id](const Phase &phase)
+                               { return phase.id_ == phase_id; });
+        return it != phases_.end() ? &*it : nullptr;
+    }
+
+    void DispatcherProfiler::resetStats()
+    {
+        for (auto &channel : channels_)
+        {
+            auto &stats = channel->stats_;
+            stats.peak_count_ = 0;
+            stats.peak_queued_ = 0;
+            stats.peak_handler_ms_ = 0.0;
+            stats.total_ = 0;
+        }
+        frames_ = 0;
+    }
+
+    bool DispatcherProfiler::exportCsv(const std::string &file_path) const
+    {
+        std::ofstream file(file_path);
+        if (!file.is_open())
+        {
+            spdlog::error("Failed to open dispatcher stats file: {}", file_path);
+            return false;
+        }
+        file << "event,total,avg_per_frame,peak_per_frame,peak_queued,last_handler_ms,peak_handler_ms\n";
+        for (const auto &channel : channels_)
+        {
+            const auto &stats = channel->stats_;
+            const double average = frames_ > 0 ? static_cast<double>(stats.total_) / static_cast<double>(frames_) : 0.0;
+            file << stats.name_ << ',' << stats.total_ << ',' << average << ',' << stats.peak_count_ << ','
+                 << stats.peak_queued_ << ',' << stats.handler_ms_ << ',' << stats.peak_handler_ms_ << '\n';
+        }
+        spdlog::info("Dispatcher stats ({} frames) exported to {}", frames_, file_path);
+        return true;
+    }
+
+    std::string DispatcherProfiler::shortName(std::string_view name)
+    {
+        // 去掉模板参数之后的部分（如果有）以及命名空间
+        if (auto pos = name.find('<'); pos != std::string_view::npos)
+            name = name.substr(0, pos);
+        if (auto pos = name.rfind("::"); pos != std::string_view::npos)
+            name = name.substr(pos + 2);
+        if (auto pos = name.rfind(' '); pos != std::string_view::npos)
+            name = name.substr(pos + 1);
+        return std::string(name);
+    }
+
+}
@@ -0,0 +1,185 @@
+#pragma once
+#include <entt/signal/dispatcher.hpp>
+#include <entt/core/type_info.hpp>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace engine::utils
+{
+
+    /// @brief 单个事件类型的分发统计
+    struct EventStats
+    {
+        std::string name_;          ///< @brief 事件类型名称（去掉命名空间）
+        size_t count_{0};           ///< @brief 上一帧处理的事件数量（包括trigger与enqueue）
+        size_t queued_{0};          ///< @brief 上一帧分发时队列中事件数量的最大值
+        double handler_ms_{0.0};    ///< @brief 上一帧分发队列中事件的处理耗时（毫秒，包括各阶段）
+        size_t peak_count_{0};      ///< @brief 单帧处理数量的最大值
+        size_t peak_queued_{0};     ///< @brief 队列长度的最大值（高水位）
+        double peak_handler_ms_{0}; ///< @brief 单帧处理耗时的最大值（毫秒）
+        size_t total_{0};           ///< @brief 累计处理数量
+        size_t frame_count_{0};     ///< @brief 当前帧已处理的数量（计数监听器累加）
+        size_t frame_queued_{0};    ///< @brief 当前帧队列长度的最大值
+        double frame_ms_{0.0};      ///< @brief 当前帧累计的处理耗时
+    };
+
+    /// @brief 分发阶段统计
+    struct PhaseStats
+    {
+        std::string name_;    ///< @brief 阶段名称
+        size_t budget_{0};    ///< @brief 每次分发最多处理的事件数量
+        size_t processed_{0}; ///< @brief 上一帧处理的事件数量
+        size_t deferred_{0};  ///< @brief 上一帧因达到预算而留到之后分发的事件数量
+        size_t frame_processed_{0};
+        size_t frame_deferred_{0};
+    };
+
+    /**
+     * @brief 事件分发统计：包装 entt::dispatcher 的每帧分发，记录各事件类型的数量、队列高水位与处理耗时
+     *
+     * 通过 track<Event>() 登记事件类型：为其连接一个计数监听器（trigger 与 enqueue 的事件都会被计数），
+     * 并在 update() 中逐类型调用 dispatcher.update<Event>() 计时。未登记的事件类型最后统一分发。
+     * update() 代替主循环中的 dispatcher.update()，每帧调用一次。
+     *
+     * 此外可以定义分发阶段（一组事件类型与事件预算），在场景更新中途调用 flush(phase_id) 立即分发：
+     * 处理函数产生的同阶段事件会在同一次 flush 中继续分发，直到队列清空或达到预算，
+     * 剩余的事件留到下一次 flush 或帧末的 update()。这样“命中 -> 伤害 -> 死亡 -> 特效”可在同一帧内完成。
+     * @note trigger 的事件立即在调用处处理，只计数不计时。
+     */
+    class DispatcherProfiler final
+    {
+    public:
+        static constexpr size_t STORM_THRESHOLD = 100; ///< @brief 单帧处理数量达到此值时视为事件风暴（调试UI中高亮）
+
+    private:
+        /// @brief 登记的事件类型
+        struct Channel
+        {
+            EventStats stats_;
+            entt::id_type type_hash_{};
+            std::function<size_t()> pending_; ///< @brief 获取队列中的事件数量
+            std::function<void()> flush_;     ///< @brief 分发队列中的事件
+        };
+
+        entt::dispatcher &dispatcher_;
+        std::vector<std::unique_ptr<Channel>> channels_;       ///< @brief 登记的事件类型（统计数据地址需保持不变）
+        std::unordered_map<entt::id_type, Channel *> tracked_; ///< @brief 事件类型哈希 -> 登记的事件类型
+
+        /// @brief 分发阶段
+        struct Phase
+        {
+            entt::id_type id_{};
+            PhaseStats stats_;
+            std::vector<Channel *> channels_; ///< @brief 阶段内的事件类型（按分发顺序）
+        };
+        std::vector<Phase> phases_;
+        double frame_ms_{0.0}; ///< @brief 上一帧分发的总耗时（毫秒）
+        size_t frames_{0};     ///< @brief 统计的帧数
+
+    public:
+        explicit DispatcherProfiler(entt::dispatcher &dispatcher);
+        ~DispatcherProfiler();
+
+        DispatcherProfiler(const DispatcherProfiler &) = delete;
+        DispatcherProfiler &operator=(const DispatcherProfiler &) = delete;
+        DispatcherProfiler(DispatcherProfiler &&) = delete;
+        DispatcherProfiler &operator=(DispatcherProfiler &&) = delete;
+
+        /// @brief 登记事件类型（重复登记会被忽略）
+        template <typename Event>
+        void track()
+        {
+            const auto &info = entt::type_id<Event>();
+            if (tracked_.contains(info.hash()))
+                return;
+
+            auto &channel = *channels_.emplace_back(std::make_unique<Channel>());
+            tracked_.emplace(info.hash(), &channel);
+            channel.type_hash_ = info.hash();
+            channel.stats_.name_ = shortName(info.name());
+            channel.pending_ = [this]()
+            { return dispatcher_.size<Event>(); };
+            channel.flush_ = [this]()
+            { dispatcher_.update<Event>(); };
+            dispatcher_.sink<Event>().template connect<&DispatcherProfiler::countEvent<Event>>(channel.stats_);
+        }
+
+        /// @brief 登记多个事件类型
+        template <typename... Events>
+        void trackAll()
+        {
+            (track<Events>(), ...);
+        }
+
+        /**
+         * @brief 定义（或重新定义）分发阶段，阶段内的事件类型会自动登记
+         * @tparam Events 阶段内的事件类型，按此顺序分发
+         * @param phase_id 阶段ID
+         * @param name 阶段名称（用于调试UI）
+         * @param budget 每次 flush 最多处理的事件数量（已开始分发的类型会整队分发完）
+         */
+        template <typename... Events>
+        void definePhase(entt::id_type phase_id, std::string name, size_t budget)
+        {
+            (track<Events>(), ...);
+            Phase phase{phase_id, PhaseStats{std::move(name), budget}, {tracked_.at(entt::type_id<Events>().hash())...}};
+            if (auto *existing = findPhase(phase_id))
+                *existing = std::move(phase);
+            else
+                phases_.push_back(std::move(phase));
+        }
+
+        /// @brief 立即分发阶段内的事件，返回处理的事件数量（阶段不存在时返回0）
+        size_t flush(entt::id_type phase_id);
+
+        void setPhaseBudget(entt::id_type phase_id, size_t budget);
+
+        /// @brief 分发所有队列中的事件并记录统计，结束当前帧
+        void update();
+
+        /// @brief 清空峰值与累计统计
+        void resetStats();
+
+        /// @brief 将统计导出为CSV文件
+        bool exportCsv(const std::string &file_path) const;
+
+        template <typename Func>
+        void forEach(Func &&func) const
+        {
+            for (const auto &channel : channels_)
+            {
+                func(channel->stats_);
+            }
+        }
+
+        template <typename Func>
+        void forEachPhase(Func &&func)
+        {
+            for (auto &phase : phases_)
+            {
+                func(phase.id_, phase.stats_);
+            }
+        }
+
+        double getFrameMs() const { return frame_ms_; }
+        size_t getFrames() const { return frames_; }
+
+    private:
+        template <typename Event>
+        static void countEvent(EventStats &stats, const Event &)
+        {
+            ++stats.frame_count_;
+        }
+
+        size_t flushChannel(Channel &channel); ///< @brief 分发一个事件类型的队列并计时，返回分发的数量
+        Phase *findPhase(entt::id_type phase_id);
+
+        static std::string shortName(std::string_view name); ///< @brief 去掉类型名称中的命名空间与struct等前缀
+    };
+
+}
@@ -1,5 +1,7 @@
 #pragma once
 #include <entt/entity/entity.hpp>
+#include <glm/vec2.hpp>
+#include <optional>
 namespace engine::scene
 {
     class Scene;
@@ -58,8 +60,15 @@ namespace engine::utils
     /// @brief 播放音效事件
     struct PlaySoundEvent
     {
-        entt::entity entity_{entt::null};    ///< @brief 目标实体（可以为空，即播放全局音效）
-        entt::id_type sound_id_{entt::null}; ///< @brief 音效ID
+        entt::entity entity_{entt::null};     ///< @brief 目标实体（可以为空，即播放全局音效）
+        entt::id_type sound_id_{entt::null};  ///< @brief 音效ID
+        std::optional<glm::vec2> position_{}; ///< @brief 发声位置（为空时使用目标实体的位置，都没有则不做定位）
+    };
+
+    /// @brief 渲染目标重置事件（SDL_EVENT_RENDER_TARGETS_RESET / SDL_EVENT_RENDER_DEVICE_RESET），渲染目标纹理的内容已丢失
+    struct RenderTargetsResetEvent
+    {
+        bool device_reset_{false}; ///< @brief 是否为渲染设备重置（此时纹理本身也需要重新创建）
     };
 
 }
\ No newline at end of file
@@ -0,0 +1,53 @@
+#include "frame_arena.h"
+#include <algorithm>
+#include <cstdint>
+
+namespace engine::utils
+{
+
+    FrameArena::FrameArena(size_t capacity, std::pmr::memory_resource *upstream)
+        : buffer_(std::make_unique<std::byte[]>(capacity)), capacity_(capacity), upstream_(upstream) {}
+
+    void FrameArena::reset()
+    {
+        stats_.bytes_ = frame_bytes_;
+        stats_.peak_bytes_ = std::max(stats_.peak_bytes_, frame_bytes_);
+        stats_.fallbacks_ = frame_fallbacks_;
+        stats_.total_fallbacks_ += frame_fallbacks_;
+        frame_bytes_ = 0;
+        frame_fallbacks_ = 0;
+        offset_ = 0;
+    }
+
+    void *FrameArena::do_allocate(size_t bytes, size_t alignment)
+    {
+        frame_bytes_ += bytes;
+        // 按实际地址对齐（缓冲区本身只保证基本对齐）
+        const auto base = reinterpret_cast<std::uintptr_t>(buffer_.get());
+        const auto aligned = (base + offset_ + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1);
+        const size_t start = aligned - base;
+        if (start + bytes <= capacity_)
+        {
+            offset_ = start + bytes;
+            return buffer_.get() + start;
+        }
+        ++frame_fallbacks_;
+        return upstream_->allocate(bytes, alignment);
+    }
+
+    void FrameArena::do_deallocate(void *p, size_t bytes, size_t alignment)
+    {
+        auto *ptr = static_cast<std::byte *>(p);
+        if (ptr >= buffer_.get() && ptr < buffer_.get() + capacity_)
+        {
+            // 释放的是最后一次分配时回退偏移量（容器扩容时很常见），否则等到帧末统一回收
+            if (ptr + bytes == buffer_.get() + offset_)
+            {
+                offset_ = static_cast<size_t>(ptr - buffer_.get());
+            }
+            return;
+        }
+        upstream_->deallocate(p, bytes, alignment);
+    }
+
+}
@@ -0,0 +1,63 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+
+namespace engine::utils
+{
+
+    /// @brief 帧内存分配统计
+    struct FrameArenaStats
+    {
+        size_t bytes_{0};           ///< @brief 上一帧分配的字节数（包括退回堆上的分配）
+        size_t peak_bytes_{0};      ///< @brief 单帧分配字节数的最大值
+        size_t fallbacks_{0};       ///< @brief 上一帧因缓冲区用尽而退回堆上的分配次数
+        size_t total_fallbacks_{0}; ///< @brief 累计退回堆上的分配次数
+    };
+
+    /**
+     * @brief 帧内存：每帧结束时整体重置的线性（bump）分配器，以 std::pmr::memory_resource 形式提供
+     *
+     * 分配只移动偏移量，释放时除了“最后一次分配”可以回退外不做任何事，帧末 reset() 一次性回收。
+     * 缓冲区用尽时退回上游资源（默认是全局堆）分配，并记录次数，可据此调整缓冲区大小。
+     * 用法：std::pmr::vector<T> temp{&frame_arena}; 只能用于当前帧内的临时容器，不能跨帧保存。
+     */
+    class FrameArena final : public std::pmr::memory_resource
+    {
+        std::unique_ptr<std::byte[]> buffer_;
+        size_t capacity_{0};
+        size_t offset_{0};                    ///< @brief 当前分配位置
+        std::pmr::memory_resource *upstream_; ///< @brief 缓冲区用尽时使用的上游资源
+
+        size_t frame_bytes_{0};     ///< @brief 当前帧已分配的字节数
+        size_t frame_fallbacks_{0}; ///< @brief 当前帧退回堆上的分配次数
+        FrameArenaStats stats_;
+
+    public:
+        /**
+         * @brief 构造函数
+         * @param capacity 缓冲区大小（字节）
+         * @param upstream 缓冲区用尽时使用的上游资源
+         */
+        explicit FrameArena(size_t capacity, std::pmr::memory_resource *upstream = std::pmr::new_delete_resource());
+
+        FrameArena(const FrameArena &) = delete;
+        FrameArena &operator=(const FrameArena &) = delete;
+        FrameArena(FrameArena &&) = delete;
+        FrameArena &operator=(FrameArena &&) = delete;
+
+        /// @brief 帧末调用：回收缓冲区并保存本帧统计（此时不能再有使用帧内存的容器存活）
+        void reset();
+
+        size_t getCapacity() const { return capacity_; }
+        size_t getUsed() const { return offset_; } ///< @brief 当前缓冲区已使用的字节数
+        const FrameArenaStats &getStats() const { return stats_; }
+        void resetStats() { stats_ = {}; }
+
+    private:
+        void *do_allocate(size_t bytes, size_t alignment) override;
+        void do_deallocate(void *p, size_t bytes, size_t alignment) override;
+        bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override { return this == &other; }
+    };
+
+}
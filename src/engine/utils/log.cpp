@@ -0,0 +1,90 @@
+#include "log.h"
+#include "ring_buffer_sink.h"
+#include <array>
+#include <memory>
+
+namespace engine::utils
+{
+    namespace
+    {
+        constexpr std::array<const char *, static_cast<size_t>(LogCategory::COUNT)> CATEGORY_NAMES{
+            "general", "system", "combat", "targeting", "audio", "loader", "entity"};
+
+        /// @brief 日志状态：各分类的记录器、同步输出端以及异步输出端
+        struct LogState
+        {
+            std::array<std::shared_ptr<spdlog::logger>, static_cast<size_t>(LogCategory::COUNT)> loggers_;
+            std::vector<spdlog::sink_ptr> sync_sinks_;   ///< @brief 原始（同步）输出端
+            std::shared_ptr<RingBufferSink> async_sink_; ///< @brief 异步输出端（init之后有效）
+
+            LogState()
+            {
+                // 通用分类直接使用spdlog默认记录器，其它分类共用它的输出端
+                auto default_logger = spdlog::default_logger();
+                sync_sinks_ = default_logger->sinks();
+                loggers_[0] = default_logger;
+                for (size_t i = 1; i < loggers_.size(); ++i)
+                {
+                    loggers_[i] = std::make_shared<spdlog::logger>(CATEGORY_NAMES[i], sync_sinks_.begin(), sync_sinks_.end());
+                    loggers_[i]->set_level(default_logger->level());
+                    spdlog::register_logger(loggers_[i]);
+                }
+            }
+
+            void setSinks(const std::vector<spdlog::sink_ptr> &sinks)
+            {
+                for (auto &logger : loggers_)
+                {
+                    logger->sinks() = sinks;
+                }
+            }
+        };
+
+        LogState &state()
+        {
+            static LogState log_state;
+            return log_state;
+        }
+    }
+
+    void Log::init(spdlog::level::level_enum level)
+    {
+        auto &log_state = state();
+        if (!log_state.async_sink_)
+        {
+            log_state.async_sink_ = std::make_shared<RingBufferSink>(log_state.sync_sinks_);
+            log_state.setSinks({log_state.async_sink_});
+        }
+        for (auto &logger : log_state.loggers_)
+        {
+            logger->set_level(level);
+        }
+    }
+
+    void Log::shutdown()
+    {
+        auto &log_state = state();
+        if (!log_state.async_sink_)
+            return;
+        log_state.setSinks(log_state.sync_sinks_);
+        log_state.async_sink_.reset(); // 析构时等待后台线程写完剩余消息
+    }
+
+    spdlog::logger &Log::get(LogCategory category)
+    {
+        return *state().loggers_[static_cast<size_t>(category)];
+    }
+
+    const char *Log::getCategoryName(LogCategory category)
+    {
+        auto index = static_cast<size_t>(category);
+        return index < CATEGORY_NAMES.size() ? CATEGORY_NAMES[index] : "unknown";
+    }
+
+    size_t Log::getDroppedCount()
+    {
+        const auto &async_sink = state().async_sink_;
+        return async_sink ? async_sink->getDroppedCount() : 0;
+    }
+
+}
@@ -0,0 +1,78 @@
+#pragma once
+#include <spdlog/spdlog.h>
+#include <cstddef>
+#include <cstdint>
+
+namespace engine::utils
+{
+
+    /// @brief 日志分类，每个分类对应一个独立的记录器，日志级别可分别调整
+    enum class LogCategory : uint8_t
+    {
+        GENERAL,   ///< @brief 通用（spdlog默认记录器，未分类的spdlog::info等调用都属于此类）
+        SYSTEM,    ///< @brief 每帧运行的系统
+        COMBAT,    ///< @brief 战斗结算、投射物
+        TARGETING, ///< @brief 索敌、阻挡
+        AUDIO,     ///< @brief 音效播放
+        LOADER,    ///< @brief 关卡与实体加载
+        ENTITY,    ///< @brief 实体生成与销毁
+        COUNT
+    };
+
+    /**
+     * @brief 日志门面：按分类管理记录器，所有分类共用一个异步环形队列输出端
+     *
+     * 使用 MW_LOG_INFO(COMBAT, "...", args) 等宏记录日志。调用线程只负责格式化消息并写入无锁队列，
+     * 输出由后台线程完成。trace/debug 级别的宏在发布版本（定义了NDEBUG）中会被完全移除。
+     */
+    class Log
+    {
+    public:
+        /**
+         * @brief 初始化：创建异步输出端并替换所有分类记录器的输出端
+         * @param level 所有分类的初始日志级别
+         */
+        static void init(spdlog::level::level_enum level = spdlog::level::info);
+
+        /// @brief 关闭：恢复同步输出端，并等待后台线程写完剩余的消息
+        static void shutdown();
+
+        /// @brief 获取分类对应的记录器（未初始化时使用同步输出端）
+        static spdlog::logger &get(LogCategory category);
+
+        static void setLevel(LogCategory category, spdlog::level::level_enum level) { get(category).set_level(level); }
+        static spdlog::level::level_enum getLevel(LogCategory category) { return get(category).level(); }
+        static const char *getCategoryName(LogCategory category);
+        static size_t getDroppedCount(); ///< @brief 异步队列已满而丢弃的消息数量
+    };
+
+}
+
+// --- 日志宏（category 为 LogCategory 的枚举名，例如 COMBAT） ---
+// 编译期级别：发布版本只保留 info 及以上，可通过预定义 MW_LOG_ACTIVE_LEVEL 覆盖
+#ifndef MW_LOG_ACTIVE_LEVEL
+#ifdef NDEBUG
+#define MW_LOG_ACTIVE_LEVEL SPDLOG_LEVEL_INFO
+#else
+#define MW_LOG_ACTIVE_LEVEL SPDLOG_LEVEL_TRACE
+#endif
+#endif
+
+#define MW_LOG_CALL(category, level, ...) \
+    engine::utils::Log::get(engine::utils::LogCategory::category).log(spdlog::source_loc{__FILE__, __LINE__, SPDLOG_FUNCTION}, level, __VA_ARGS__)
+
+#if MW_LOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_TRACE
+#define MW_LOG_TRACE(category, ...) MW_LOG_CALL(category, spdlog::level::trace, __VA_ARGS__)
+#else
+#define MW_LOG_TRACE(category, ...) (void)0
+#endif
+
+#if MW_LOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_DEBUG
+#define MW_LOG_DEBUG(category, ...) MW_LOG_CALL(category, spdlog::level::debug, __VA_ARGS__)
+#else
+#define MW_LOG_DEBUG(category, ...) (void)0
+#endif
+
+#define MW_LOG_INFO(category, ...) MW_LOG_CALL(category, spdlog::level::info, __VA_ARGS__)
+#define MW_LOG_WARN(category, ...) MW_LOG_CALL(category, spdlog::level::warn, __VA_ARGS__)
+#define MW_LOG_ERROR(category, ...) MW_LOG_CALL(category, spdlog::level::err, __VA_ARGS__)
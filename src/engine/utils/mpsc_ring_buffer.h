@@ -0,0 +1,103 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace engine::utils
+{
+
+    /**
+     * @brief 有界无锁环形队列（多生产者、单消费者）
+     *
+     * 每个槽位带有一个序号：生产者通过CAS抢占写入位置，写完后发布序号；消费者只在序号就绪时读取。
+     * 元素在槽位内原地写入/读取（通过回调），避免额外的拷贝。队列满时写入失败，由调用者决定丢弃策略。
+     * @tparam T 元素类型（需要可默认构造）
+     * @tparam Capacity 容量（必须是2的幂）
+     */
+    template <typename T, size_t Capacity>
+    class MpscRingBuffer
+    {
+        static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+        static constexpr size_t MASK = Capacity - 1;
+
+        struct Cell
+        {
+            std::atomic<size_t> sequence_{0};
+            T data_{};
+        };
+
+        std::unique_ptr<Cell[]> cells_;                  ///< @brief 槽位数组
+        alignas(64) std::atomic<size_t> enqueue_pos_{0}; ///< @brief 下一个写入位置（生产者共享）
+        alignas(64) size_t dequeue_pos_{0};              ///< @brief 下一个读取位置（只有消费者访问）
+
+    public:
+        MpscRingBuffer() : cells_(std::make_unique<Cell[]>(Capacity))
+        {
+            for (size_t i = 0; i < Capacity; ++i)
+            {
+                cells_[i].sequence_.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        MpscRingBuffer(const MpscRingBuffer &) = delete;
+        MpscRingBuffer &operator=(const MpscRingBuffer &) = delete;
+
+        /**
+         * @brief 尝试写入一个元素（可在任意线程调用）
+         * @param fill 回调 void(T&)，在抢占到的槽位内写入数据
+         * @return 队列已满时返回false
+         */
+        template <typename Fill>
+        bool tryPush(Fill &&fill)
+        {
+            size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                Cell &cell = cells_[pos & MASK];
+                size_t sequence = cell.sequence_.load(std::memory_order_acquire);
+                auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+                if (diff == 0)
+                {
+                    if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        fill(cell.data_);
+                        cell.sequence_.store(pos + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false; // 队列已满
+                }
+                else
+                {
+                    pos = enqueue_pos_.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        /**
+         * @brief 尝试读取一个元素（只能在消费者线程调用）
+         * @param consume 回调 void(T&)，在槽位内读取数据
+         * @return 队列为空时返回false
+         */
+        template <typename Consume>
+        bool tryPop(Consume &&consume)
+        {
+            Cell &cell = cells_[dequeue_pos_ & MASK];
+            size_t sequence = cell.sequence_.load(std::memory_order_acquire);
+            if (static_cast<intptr_t>(sequence) - static_cast<intptr_t>(dequeue_pos_ + 1) < 0)
+            {
+                return false; // 队列为空（或生产者尚未写完）
+            }
+            consume(cell.data_);
+            cell.sequence_.store(dequeue_pos_ + Capacity, std::memory_order_release);
+            ++dequeue_pos_;
+            return true;
+        }
+
+        static constexpr size_t capacity() { return Capacity; }
+    };
+
+}
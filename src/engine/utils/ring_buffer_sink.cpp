@@ -0,0 +1,100 @@
+#include "ring_buffer_sink.h"
+#include <spdlog/details/log_msg.h>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+namespace engine::utils
+{
+
+    RingBufferSink::RingBufferSink(std::vector<spdlog::sink_ptr> targets)
+        : targets_(std::move(targets))
+    {
+        worker_ = std::thread(&RingBufferSink::run, this);
+    }
+
+    RingBufferSink::~RingBufferSink()
+    {
+        running_.store(false, std::memory_order_release);
+        if (worker_.joinable())
+        {
+            worker_.join();
+        }
+    }
+
+    void RingBufferSink::log(const spdlog::details::log_msg &msg)
+    {
+        bool pushed = queue_.tryPush([&msg](Record &record)
+                                     {
+            record.time_ = msg.time;
+            record.level_ = msg.level;
+            record.logger_name_ = msg.logger_name;
+            record.thread_id_ = msg.thread_id;
+            record.size_ = static_cast<uint16_t>(std::min(msg.payload.size(), MAX_MESSAGE_SIZE));
+            std::memcpy(record.payload_, msg.payload.data(), record.size_); });
+        if (!pushed)
+        {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    void RingBufferSink::flush()
+    {
+        for (auto &target : targets_)
+        {
+            target->flush();
+        }
+    }
+
+    void RingBufferSink::set_pattern(const std::string &pattern)
+    {
+        for (auto &target : targets_)
+        {
+            target->set_pattern(pattern);
+        }
+    }
+
+    void RingBufferSink::set_formatter(std::unique_ptr<spdlog::formatter> sink_formatter)
+    {
+        for (auto &target : targets_)
+        {
+            target->set_formatter(sink_formatter->clone());
+        }
+    }
+
+    void RingBufferSink::run()
+    {
+        while (running_.load(std::memory_order_acquire))
+        {
+            if (!drain())
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(2)); // 队列为空时短暂休眠
+            }
+        }
+        // 退出前写完剩余的消息
+        drain();
+        flush();
+    }
+
+    bool RingBufferSink::drain()
+    {
+        bool any = false;
+        while (queue_.tryPop([this](Record &record)
+                             {
+            spdlog::details::log_msg msg(record.time_, spdlog::source_loc{}, record.logger_name_, record.level_,
+                                         spdlog::string_view_t(record.payload_, record.size_));
+            msg.thread_id = record.thread_id_;
+            for (auto &target : targets_)
+            {
+                if (target->should_log(msg.level))
+                {
+                    target->log(msg);
+                }
+            } }))
+        {
+            any = true;
+        }
+        return any;
+    }
+
+}
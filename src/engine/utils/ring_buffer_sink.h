@@ -0,0 +1,59 @@
+#pragma once
+#include "mpsc_ring_buffer.h"
+#include <spdlog/sinks/sink.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace engine::utils
+{
+
+    /**
+     * @brief 异步日志输出端：调用线程只把格式化好的消息写入无锁环形队列，由后台线程写到真正的输出端
+     *
+     * 过长的消息会被截断；队列满时丢弃新消息并计数（日志不应阻塞游戏线程）。
+     */
+    class RingBufferSink final : public spdlog::sinks::sink
+    {
+    public:
+        static constexpr size_t CAPACITY = 4096;        ///< @brief 队列容量（条）
+        static constexpr size_t MAX_MESSAGE_SIZE = 240; ///< @brief 单条消息最大长度（字节），超出部分截断
+
+    private:
+        /// @brief 队列中的一条日志记录
+        struct Record
+        {
+            spdlog::log_clock::time_point time_{};
+            spdlog::level::level_enum level_{spdlog::level::info};
+            spdlog::string_view_t logger_name_{}; ///< @brief 记录器名称（记录器常驻，名称字符串一直有效）
+            size_t thread_id_{0};
+            uint16_t size_{0};
+            char payload_[MAX_MESSAGE_SIZE]{};
+        };
+
+        std::vector<spdlog::sink_ptr> targets_;  ///< @brief 真正的输出端（由后台线程写入）
+        MpscRingBuffer<Record, CAPACITY> queue_; ///< @brief 无锁环形队列
+        std::atomic<size_t> dropped_{0};         ///< @brief 因队列已满而丢弃的消息数量
+        std::atomic<bool> running_{true};        ///< @brief 后台线程是否继续运行
+        std::thread worker_;                     ///< @brief 后台线程
+
+    public:
+        /// @brief 创建输出端并启动后台线程
+        explicit RingBufferSink(std::vector<spdlog::sink_ptr> targets);
+        /// @brief 停止后台线程，写完队列中剩余的消息
+        ~RingBufferSink() override;
+
+        void log(const spdlog::details::log_msg &msg) override;
+        void flush() override;
+        void set_pattern(const std::string &pattern) override;
+        void set_formatter(std::unique_ptr<spdlog::formatter> sink_formatter) override;
+
+        const std::vector<spdlog::sink_ptr> &getTargets() const { return targets_; }
+        size_t getDroppedCount() const { return dropped_.load(std::memory_order_relaxed); }
+
+    private:
+        void run();   ///< @brief 后台线程主循环
+        bool drain(); ///< @brief 写出队列中的所有消息，没有消息时返回false
+    };
+
+}
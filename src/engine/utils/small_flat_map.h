@@ -0,0 +1,187 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace engine::utils
+{
+    /**
+     * @brief 带小缓冲区优化的有序扁平映射，适合元素很少（通常2~6个）的 id -> 值 表
+     *
+     * 元素按键有序连续存放：数量不超过 N 时保存在对象内部的数组中，不进行堆分配；
+     * 超过 N 时整体搬到 std::vector 中。查找时元素较少则线性扫描，较多则二分查找。
+     * 接口与 std::unordered_map 的常用部分保持一致（find / emplace / contains / 范围for 等）。
+     * @tparam Key 键类型（需要支持 < 与 ==，且可默认构造）
+     * @tparam Value 值类型（需要可默认构造）
+     * @tparam N 内部缓冲区容量
+     * @note 插入与删除会使迭代器失效
+     */
+    template <typename Key, typename Value, size_t N = 4>
+    class SmallFlatMap
+    {
+    public:
+        using key_type = Key;
+        using mapped_type = Value;
+        using value_type = std::pair<Key, Value>;
+        using iterator = value_type *;
+        using const_iterator = const value_type *;
+
+    private:
+        static constexpr size_t LINEAR_SEARCH_LIMIT = 8; ///< @brief 元素数量不超过此值时使用线性查找
+
+        std::array<value_type, N> inline_{}; ///< @brief 内部缓冲区
+        std::vector<value_type> heap_;       ///< @brief 元素超过 N 时使用的堆存储
+        size_t size_{0};                     ///< @brief 元素数量
+
+    public:
+        SmallFlatMap() = default;
+        SmallFlatMap(std::initializer_list<value_type> init)
+        {
+            for (const auto &[key, value] : init)
+            {
+                emplace(key, value);
+            }
+        }
+        SmallFlatMap(const SmallFlatMap &) = default;
+        SmallFlatMap &operator=(const SmallFlatMap &) = default;
+        // 移动后源对象必须回到空状态（默认的移动会留下 size_ 但清空 heap_，导致越界访问 inline_）
+        SmallFlatMap(SmallFlatMap &&other) noexcept
+            : inline_(std::move(other.inline_)), heap_(std::move(other.heap_)), size_(other.size_)
+        {
+            other.clear();
+        }
+        SmallFlatMap &operator=(SmallFlatMap &&other) noexcept
+        {
+            if (this != &other)
+            {
+                inline_ = std::move(other.inline_);
+                heap_ = std::move(other.heap_);
+                size_ = other.size_;
+                other.clear();
+            }
+            return *this;
+        }
+
+        // --- 迭代器 ---
+        iterator begin() { return data(); }
+        iterator end() { return data() + size_; }
+        const_iterator begin() const { return data(); }
+        const_iterator end() const { return data() + size_; }
+
+        size_t size() const { return size_; }
+        bool empty() const { return size_ == 0; }
+        bool isInline() const { return size_ <= N; } ///< @brief 元素是否保存在内部缓冲区中
+
+        void clear()
+        {
+            heap_.clear();
+            inline_ = {};
+            size_ = 0;
+        }
+
+        iterator find(const Key &key) { return const_cast<iterator>(std::as_const(*this).find(key)); }
+        const_iterator find(const Key &key) const
+        {
+            auto it = lowerBound(key);
+            return (it != end() && it->first == key) ? it : end();
+        }
+
+        bool contains(const Key &key) const { return find(key) != end(); }
+
+        /// @brief 插入键值对，键已存在时不做修改
+        /// @return 指向（新插入或已存在）元素的迭代器，以及是否插入成功
+        std::pair<iterator, bool> emplace(const Key &key, Value value)
+        {
+            auto it = lowerBound(key);
+            if (it != end() && it->first == key)
+            {
+                return {it, false};
+            }
+            return {insertAt(static_cast<size_t>(it - begin()), key, std::move(value)), true};
+        }
+
+        /// @brief 插入或覆盖键值对
+        iterator insert_or_assign(const Key &key, Value value)
+        {
+            auto [it, inserted] = emplace(key, value);
+            if (!inserted)
+            {
+                it->second = std::move(value);
+            }
+            return it;
+        }
+
+        /// @brief 获取键对应的值，不存在时插入默认值
+        Value &operator[](const Key &key) { return emplace(key, Value{}).first->second; }
+
+        /// @brief 删除键，返回删除的元素数量（0或1）
+        size_t erase(const Key &key)
+        {
+            auto it = find(key);
+            if (it == end())
+                return 0;
+            std::move(it + 1, end(), it);
+            --size_;
+            if (size_ >= N) // 删除前元素保存在堆上
+            {
+                heap_.pop_back();
+                if (size_ <= N) // 元素数量回到缓冲区容量以内时搬回内部
+                {
+                    std::move(heap_.begin(), heap_.end(), inline_.begin());
+                    heap_.clear();
+                    heap_.shrink_to_fit();
+                }
+            }
+            else
+            {
+                inline_[size_] = value_type{};
+            }
+            return 1;
+        }
+
+    private:
+        // 存储位置由元素数量决定（size_ > N 时 heap_ 一定非空）
+        value_type *data() { return size_ <= N ? inline_.data() : heap_.data(); }
+        const value_type *data() const { return size_ <= N ? inline_.data() : heap_.data(); }
+
+        const_iterator lowerBound(const Key &key) const
+        {
+            if (size_ <= LINEAR_SEARCH_LIMIT)
+            {
+                auto it = begin();
+                while (it != end() && it->first < key)
+                {
+                    ++it;
+                }
+                return it;
+            }
+            return std::lower_bound(begin(), end(), key, [](const value_type &entry, const Key &k)
+                                    { return entry.first < k; });
+        }
+        iterator lowerBound(const Key &key) { return const_cast<iterator>(std::as_const(*this).lowerBound(key)); }
+
+        iterator insertAt(size_t index, const Key &key, Value value)
+        {
+            if (size_ < N)
+            {
+                std::move_backward(inline_.begin() + index, inline_.begin() + size_, inline_.begin() + size_ + 1);
+                inline_[index] = value_type{key, std::move(value)};
+                ++size_;
+                return inline_.data() + index;
+            }
+            if (size_ == N) // 内部缓冲区已满，整体搬到堆上
+            {
+                heap_.reserve(N * 2);
+                std::move(inline_.begin(), inline_.begin() + size_, std::back_inserter(heap_));
+                inline_ = {};
+            }
+            heap_.insert(heap_.begin() + index, value_type{key, std::move(value)});
+            ++size_;
+            return heap_.data() + index;
+        }
+    };
+}
@@ -0,0 +1,62 @@
+#include "string_interner.h"
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
+namespace engine::utils
+{
+    namespace
+    {
+        /// @brief 字符串表的实际存储（deque保证追加时已有元素的引用不失效）
+        struct InternTable
+        {
+            std::mutex mutex_;
+            std::deque<std::string> strings_{std::string{}};
+            std::unordered_map<std::string_view, uint32_t> indices_{{std::string_view{}, 0}};
+        };
+
+        InternTable &table()
+        {
+            static InternTable instance;
+            return instance;
+        }
+    }
+
+    InternedString::InternedString(std::string_view str)
+        : index_(StringInterner::intern(str)) {}
+
+    const std::string &InternedString::str() const
+    {
+        return StringInterner::get(index_);
+    }
+
+    uint32_t StringInterner::intern(std::string_view str)
+    {
+        if (str.empty())
+            return 0;
+        auto &t = table();
+        std::lock_guard lock(t.mutex_);
+        if (auto it = t.indices_.find(str); it != t.indices_.end())
+        {
+            return it->second;
+        }
+        auto index = static_cast<uint32_t>(t.strings_.size());
+        const auto &stored = t.strings_.emplace_back(str);
+        t.indices_.emplace(std::string_view(stored), index);
+        return index;
+    }
+
+    const std::string &StringInterner::get(uint32_t index)
+    {
+        auto &t = table();
+        std::lock_guard lock(t.mutex_);
+        return index < t.strings_.size() ? t.strings_[index] : t.strings_.front();
+    }
+
+    size_t StringInterner::size()
+    {
+        auto &t = table();
+        std::lock_guard lock(t.mutex_);
+        return t.strings_.size();
+    }
+}
@@ -0,0 +1,49 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace engine::utils
+{
+    /**
+     * @brief 驻留字符串句柄，只保存全局字符串表中的索引（4字节）
+     *
+     * 相同内容的字符串共享同一份存储，组件中使用它代替 std::string 可以保持组件为小型POD结构。
+     * 索引从0开始连续分配（0 为空字符串），因此也可以直接作为数组下标使用（如纹理表）。
+     * @note 字符串一旦驻留就不会释放，适合名称、路径、描述等数量有限的字符串
+     */
+    class InternedString
+    {
+        uint32_t index_{0}; ///< @brief 字符串表中的索引
+
+    public:
+        InternedString() = default;
+        InternedString(std::string_view str);
+        InternedString(const std::string &str) : InternedString(std::string_view(str)) {}
+        InternedString(const char *str) : InternedString(std::string_view(str)) {}
+
+        const std::string &str() const; ///< @brief 获取字符串内容（引用在程序运行期间始终有效）
+        const char *c_str() const { return str().c_str(); }
+        uint32_t index() const { return index_; }
+        bool empty() const { return index_ == 0; }
+
+        bool operator==(const InternedString &other) const { return index_ == other.index_; }
+    };
+
+    /**
+     * @brief 全局字符串驻留表
+     * @note 线程安全（关卡预加载等工作线程也可能创建驻留字符串）
+     */
+    class StringInterner final
+    {
+    public:
+        StringInterner() = delete;
+
+        /// @brief 驻留字符串，返回其索引（已存在时直接返回原索引）
+        static uint32_t intern(std::string_view str);
+        /// @brief 根据索引获取字符串，无效索引返回空字符串
+        static const std::string &get(uint32_t index);
+        /// @brief 当前驻留的字符串数量（包括空字符串）
+        static size_t size();
+    };
+}
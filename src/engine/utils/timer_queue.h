@@ -0,0 +1,64 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace engine::utils
+{
+    /**
+     * @brief 按截止时间排序的计时器队列（最小堆）
+     *
+     * 计时器只在注册时入队一次，每帧只弹出已到期的计时器，开销与到期数量成正比，与计时器总数无关。
+     * 队列不支持删除：取消或修改计时器时由使用者在弹出时判断是否过期（惰性删除）。
+     * @tparam Payload 计时器携带的数据（如实体与计时器类型）
+     */
+    template <typename Payload>
+    class TimerQueue
+    {
+        struct Entry
+        {
+            float deadline_; ///< @brief 截止时间
+            Payload payload_;
+
+            bool operator>(const Entry &other) const { return deadline_ > other.deadline_; }
+        };
+
+        std::vector<Entry> heap_; ///< @brief 最小堆（堆顶为最早到期的计时器）
+
+    public:
+        /// @brief 注册计时器
+        void push(float deadline, Payload payload)
+        {
+            heap_.push_back(Entry{deadline, std::move(payload)});
+            std::push_heap(heap_.begin(), heap_.end(), std::greater<>{});
+        }
+
+        /**
+         * @brief 依次弹出所有截止时间不晚于now的计时器
+         * @param now 当前时间
+         * @param callback 回调函数，参数为(float deadline, Payload &payload)，回调中可以继续push
+         * @return 弹出的计时器数量
+         */
+        template <typename Callback>
+        size_t popExpired(float now, Callback &&callback)
+        {
+            size_t count = 0;
+            while (!heap_.empty() && heap_.front().deadline_ <= now)
+            {
+                std::pop_heap(heap_.begin(), heap_.end(), std::greater<>{});
+                Entry entry = std::move(heap_.back());
+                heap_.pop_back();
+                callback(entry.deadline_, entry.payload_);
+                ++count;
+            }
+            return count;
+        }
+
+        /// @brief 最早到期的截止时间（队列为空时不可调用）
+        float nextDeadline() const { return heap_.front().deadline_; }
+        size_t size() const { return heap_.size(); }
+        bool empty() const { return heap_.empty(); }
+        void clear() { heap_.clear(); }
+    };
+}
@@ -1,6 +1,6 @@
 #pragma once
+#include "../../engine/utils/string_interner.h"
 #include <entt/entity/entity.hpp>
-#include <string>
 
 namespace game::component
 {
@@ -13,7 +13,7 @@ namespace game::component
     struct ClassNameComponent
     {
         entt::id_type class_id_{entt::null};
-        std::string class_name_; // 可以是中文，主要用于显示
+        engine::utils::InternedString class_name_; // 可以是中文，主要用于显示
     };
 
 }
\ No newline at end of file
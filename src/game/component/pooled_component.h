@@ -0,0 +1,28 @@
+#pragma once
+#include <entt/entity/entity.hpp>
+#include <cstdint>
+
+namespace game::component
+{
+
+    /// @brief 对象池类型（同一蓝图在不同用途下的实体组件不同，因此分开管理）
+    enum class PoolType : uint8_t
+    {
+        EFFECT,            ///< @brief 一次性特效（特效蓝图）
+        ENEMY_DEAD_EFFECT, ///< @brief 敌人死亡特效（敌人蓝图的“damage”动画）
+        SKILL_DISPLAY,     ///< @brief 技能标识（特效蓝图，循环播放）
+        COUNT
+    };
+
+    /**
+     * @brief 对象池组件，附加在由EntityPool管理的实体上
+     *
+     * 带有此组件的实体在添加DeadTag后不会被销毁，而是由RemoveDeadSystem回收到对应的对象池中。
+     */
+    struct PooledComponent
+    {
+        PoolType type_{PoolType::EFFECT}; ///< @brief 对象池类型
+        entt::id_type id_{entt::null};    ///< @brief 蓝图ID
+    };
+
+}
@@ -1,24 +1,24 @@
 #pragma once
+#include "../../engine/utils/string_interner.h"
 #include <entt/entity/entity.hpp>
-#include <string>
 
 namespace game::component
 {
 
     /**
      * @brief 技能组件
-     * @note 用于存储技能信息，包括技能ID、用于显示特效的实体ID、名称、描述、冷却时间、计时器等。
+     * @note 用于存储技能信息，包括技能ID、用于显示特效的实体ID、名称、描述、冷却时间、计时开始时间等。
      */
     struct SkillComponent
     {
-        entt::id_type skill_id_{entt::null};      ///< 技能ID
-        entt::entity display_entity_{entt::null}; ///< 用于显示特效的实体ID
-        std::string name_;                        ///< @brief 技能名称
-        std::string description_;                 ///< @brief 技能描述
-        float cooldown_{0.0f};                    ///< @brief 技能冷却时间
-        float duration_{0.0f};                    ///< @brief 技能持续时间
-        float cooldown_timer_{0.0f};              ///< @brief 技能冷却计时器
-        float duration_timer_{0.0f};              ///< @brief 技能持续计时器
+        entt::id_type skill_id_{entt::null};        ///< 技能ID
+        entt::entity display_entity_{entt::null};   ///< 用于显示特效的实体ID
+        engine::utils::InternedString name_;        ///< @brief 技能名称
+        engine::utils::InternedString description_; ///< @brief 技能描述
+        float cooldown_{0.0f};                      ///< @brief 技能冷却时间
+        float duration_{0.0f};                      ///< @brief 技能持续时间
+        float cooldown_start_time_{0.0f};           ///< @brief 技能冷却开始的游戏时间（由TimerSystem维护）
+        float duration_start_time_{0.0f};           ///< @brief 技能激活开始的游戏时间（由TimerSystem维护）
     };
 
 }
\ No newline at end of file
@@ -0,0 +1,54 @@
+#pragma once
+#include "../defs/tags.h"
+#include <entt/entity/registry.hpp>
+#include <cstddef>
+#include <vector>
+
+namespace game::data
+{
+
+    /// @brief 一帧内的实体清理统计
+    struct DeadStats
+    {
+        size_t destroyed_{0};       ///< @brief 本帧销毁的实体数量
+        size_t recycled_{0};        ///< @brief 本帧回收到对象池的实体数量
+        size_t total_destroyed_{0}; ///< @brief 累计销毁的实体数量
+        size_t total_recycled_{0};  ///< @brief 累计回收的实体数量
+    };
+
+    /**
+     * @brief 延迟销毁队列，保存在注册表上下文中
+     *
+     * 所有需要删除的实体都通过markDead()标记（添加DeadTag并入队），
+     * 由RemoveDeadSystem在下一帧开始时统一执行清理钩子并批量销毁。
+     */
+    class DeadQueue
+    {
+        std::vector<entt::entity> entities_; ///< @brief 等待销毁的实体
+        DeadStats stats_;                    ///< @brief 清理统计（由RemoveDeadSystem更新）
+
+    public:
+        /// @brief 标记实体死亡并加入队列（无效或已标记的实体会被忽略）
+        void markDead(entt::registry &registry, entt::entity entity)
+        {
+            if (entity == entt::null || !registry.valid(entity) || registry.all_of<game::defs::DeadTag>(entity))
+                return;
+            registry.emplace<game::defs::DeadTag>(entity);
+            entities_.push_back(entity);
+        }
+
+        /// @brief 取出所有等待销毁的实体（与传入的缓冲区交换，便于复用容量）
+        void swap(std::vector<entt::entity> &entities) { entities_.swap(entities); }
+
+        size_t size() const { return entities_.size(); }
+        const DeadStats &getStats() const { return stats_; }
+        DeadStats &getStats() { return stats_; }
+    };
+
+    /// @brief 标记实体死亡的统一入口（注册表上下文中必须存在DeadQueue）
+    inline void markDead(entt::registry &registry, entt::entity entity)
+    {
+        registry.ctx().get<DeadQueue>().markDead(registry, entity);
+    }
+
+}
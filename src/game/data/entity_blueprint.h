@@ -1,11 +1,18 @@
 #pragma once
 #include "../../engine/utils/math.h"
+#include "../../engine/utils/small_flat_map.h"
 #include "../defs/constants.h"
 #include <string>
 #include <vector>
 #include <unordered_map>
 #include <entt/entity/entity.hpp>
 #include <glm/vec2.hpp>
+#include <memory>
+
+namespace engine::component
+{
+    class AnimationClipSet;
+}
 
 /* 蓝图结构体，为实体工厂提供数据 */
 namespace game::data
@@ -38,13 +45,13 @@ namespace game::data
         float ms_per_frame_{0.0f};
         int row_{0};
         std::vector<int> frames_;                       ///< @brief 动画帧索引数组
-        std::unordered_map<int, entt::id_type> events_; ///< @brief 动画事件，键为帧索引，值为事件ID
+        engine::utils::SmallFlatMap<int, entt::id_type> events_; ///< @brief 动画事件，键为帧索引，值为事件ID
     };
 
     /// @brief 声音蓝图, 用于创建声音组件
     struct SoundBlueprint
     {
-        std::unordered_map<entt::id_type, entt::id_type> sounds_;
+        engine::utils::SmallFlatMap<entt::id_type, entt::id_type> sounds_; ///< @brief 音效键 -> 音效ID
     };
 
     /// @brief 玩家蓝图, 用于创建玩家组件、放置类型、阻挡数量等
@@ -82,6 +89,7 @@ namespace game::data
         SpriteBlueprint sprite_{};
         DisplayInfoBlueprint display_info_{};
         std::unordered_map<entt::id_type, AnimationBlueprint> animations_;
+        std::shared_ptr<const engine::component::AnimationClipSet> clip_set_; ///< @brief 由animations_编译的动画片段集合（同类实体共享）
     };
 
     /// @brief 敌人类型蓝图, 包含所有必要的子蓝图，用于创建敌人实体中的所有组件
@@ -96,6 +104,7 @@ namespace game::data
         SpriteBlueprint sprite_{};
         DisplayInfoBlueprint display_info_{};
         std::unordered_map<entt::id_type, AnimationBlueprint> animations_;
+        std::shared_ptr<const engine::component::AnimationClipSet> clip_set_; ///< @brief 由animations_编译的动画片段集合（同类实体共享）
     };
 
     /// @brief 投射物蓝图, 用于创建投射物组件
@@ -116,6 +125,7 @@ namespace game::data
         std::string name_;
         SpriteBlueprint sprite_{};
         AnimationBlueprint animation_{};
+        std::shared_ptr<const engine::component::AnimationClipSet> clip_set_; ///< @brief 由animation_编译的动画片段集合（片段名称为特效id）
     };
 
     /// @brief 增益蓝图, 用于给角色添加Buff
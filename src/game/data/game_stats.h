@@ -6,7 +6,7 @@ namespace game::data
     /**
      * @brief 关卡内游戏资源及统计数据
      *
-     * 包含可用cost、cost生成速率、基地血量、敌人数量、敌人到达数量、敌人击杀数量等。
+     * 包含可用cost、cost生成速率、基地血量、敌人数量、敌人到达数量、敌人击杀数量、游戏时间等。
      */
     struct GameStats
     {
@@ -16,6 +16,7 @@ namespace game::data
         int enemy_count_{0};              ///< @brief 敌人(总)数量
         int enemy_arrived_count_{0};      ///< @brief 敌人到达数量
         int enemy_killed_count_{0};       ///< @brief 敌人击杀数量
+        float game_time_{0.0f};           ///< @brief 关卡内经过的游戏时间（秒），由TimerSystem推进
     };
 
 }
\ No newline at end of file
@@ -0,0 +1,46 @@
+#pragma once
+#include "waypoint_node.h"
+#include "../defs/tags.h"
+#include "../../engine/scene/registry_snapshot.h"
+#include "../../engine/component/name_component.h"
+#include "../../engine/component/transform_component.h"
+#include "../../engine/component/parallax_component.h"
+#include "../../engine/component/sprite_component.h"
+#include "../../engine/component/render_component.h"
+#include "../../engine/component/tilelayer_component.h"
+#include "../../engine/component/animation_component.h"
+#include <unordered_map>
+#include <vector>
+
+namespace game::data
+{
+
+    /**
+     * @brief 关卡加载完成后的快照
+     *
+     * 在关卡首次加载（地图解析 + 实体生成）后捕获，重开同一关卡时直接恢复，跳过地图解析和实体创建。
+     * 由GameScene在重开时传递给新的GameScene（与BlueprintManager、LevelConfig等共享数据一样使用共享指针）。
+     * @note 组件列表需要覆盖LevelLoader与EntityBuilderMW创建的所有组件，新增地图组件时需同步添加
+     */
+    struct LevelSnapshot
+    {
+        using Registry = engine::scene::RegistrySnapshot<engine::component::NameComponent,
+                                                         engine::component::TransformComponent,
+                                                         engine::component::ParallaxComponent,
+                                                         engine::component::SpriteComponent,
+                                                         engine::component::RenderComponent,
+                                                         engine::component::TileLayerComponent,
+                                                         engine::component::AnimationComponent,
+                                                         game::defs::MeleePlaceTag,
+                                                         game::defs::RangedPlaceTag>;
+
+        int level_number_{0};                                              ///< @brief 快照对应的关卡编号
+        Registry registry_;                                                ///< @brief 地图实体与组件
+        std::unordered_map<int, game::data::WaypointNode> waypoint_nodes_; ///< @brief 路径节点
+        std::vector<int> start_points_;                                    ///< @brief 起始点
+
+        /// @brief 快照是否可用于指定关卡
+        [[nodiscard]] bool isValidFor(int level_number) const { return registry_.isValid() && level_number_ == level_number; }
+    };
+
+}
@@ -0,0 +1,119 @@
+#include "projectile_pool.h"
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+namespace game::data
+{
+    namespace
+    {
+        template <typename T>
+        void swapPop(std::vector<T> &values, size_t index)
+        {
+            values[index] = values.back();
+            values.pop_back();
+        }
+
+        void swapPop(engine::utils::Vec2SoA &values, size_t index)
+        {
+            swapPop(values.x, index);
+            swapPop(values.y, index);
+        }
+    }
+
+    void ProjectilePool::spawn(uint16_t visual, const glm::vec2 &start_position, const glm::vec2 &target_position,
+                               entt::entity target, float damage, float arc_height, float flight_time)
+    {
+        start_.push(start_position);
+        target_position_.push(target_position);
+        position_.push(start_position);
+        previous_.push(start_position);
+        arc_height_.push_back(arc_height);
+        flight_time_.push_back(flight_time);
+        elapsed_.push_back(0.0f);
+        progress_.push_back(0.0f);
+        rotation_.push_back(0.0f);
+        damage_.push_back(damage);
+        target_.push_back(target);
+        visual_.push_back(visual);
+        peak_size_ = std::max(peak_size_, size());
+    }
+
+    const std::vector<ProjectileArrival> &ProjectilePool::update(float delta_time)
+    {
+        arrivals_.clear();
+        // 1. 累加飞行时间
+        for (auto &elapsed : elapsed_)
+        {
+            elapsed += delta_time;
+        }
+
+        // 2. 飞行时间超过总飞行时间的投射物命中目标，记录后移除
+        for (size_t i = 0; i < size();)
+        {
+            if (elapsed_[i] >= flight_time_[i])
+            {
+                arrivals_.push_back({target_[i], damage_[i], visual_[i], target_position_.get(i)});
+                removeAt(i); // 末尾元素被换到位置i，不递增i
+                continue;
+            }
+            ++i;
+        }
+
+        // 3. 计算飞行进度，并批量计算弧形轨迹上的位置
+        const auto count = size();
+        for (size_t i = 0; i < count; ++i)
+        {
+            progress_[i] = elapsed_[i] / flight_time_[i];
+        }
+        engine::utils::lerpArcBatch(start_.x.data(), start_.y.data(),
+                                    target_position_.x.data(), target_position_.y.data(),
+                                    progress_.data(), arc_height_.data(),
+                                    position_.x.data(), position_.y.data(), count);
+
+        // 4. 根据上一帧的位置计算朝向，并更新上一帧位置
+        for (size_t i = 0; i < count; ++i)
+        {
+            float dx = position_.x[i] - previous_.x[i];
+            float dy = position_.y[i] - previous_.y[i];
+            rotation_[i] = std::atan2(dy, dx) * 180.0f / std::numbers::pi_v<float>;
+        }
+        previous_.x = position_.x;
+        previous_.y = position_.y;
+        return arrivals_;
+    }
+
+    void ProjectilePool::clear()
+    {
+        start_.clear();
+        target_position_.clear();
+        position_.clear();
+        previous_.clear();
+        arc_height_.clear();
+        flight_time_.clear();
+        elapsed_.clear();
+        progress_.clear();
+        rotation_.clear();
+        damage_.clear();
+        target_.clear();
+        visual_.clear();
+        arrivals_.clear();
+    }
+
+    void ProjectilePool::removeAt(size_t index)
+    {
+        swapPop(start_, index);
+        swapPop(target_position_, index);
+        swapPop(position_, index);
+        swapPop(previous_, index);
+        swapPop(arc_height_, index);
+        swapPop(flight_time_, index);
+        swapPop(elapsed_, index);
+        swapPop(progress_, index);
+        swapPop(rotation_, index);
+        swapPop(damage_, index);
+        swapPop(target_, index);
+        swapPop(visual_, index);
+    }
+
+}
@@ -0,0 +1,78 @@
+#pragma once
+#include "../../engine/utils/batch_math.h"
+#include <entt/entity/entity.hpp>
+#include <glm/vec2.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace game::data
+{
+
+    /// @brief 到达终点的投射物（由ProjectilePool::update输出，用于发送攻击事件）
+    struct ProjectileArrival
+    {
+        entt::entity target_{entt::null}; ///< @brief 目标实体
+        float damage_{};                  ///< @brief 伤害
+        uint16_t visual_{};               ///< @brief 外观索引（用于查找命中音效）
+        glm::vec2 position_{};            ///< @brief 命中位置（用于定位命中音效）
+    };
+
+    /**
+     * @brief 投射物池，以SoA（结构数组）形式保存所有飞行中的投射物
+     *
+     * 投射物不再是注册表中的实体：每个字段单独连续存放，每帧一次性批量更新飞行进度与弧形轨迹，
+     * 到达终点的投射物通过交换删除（与末尾元素交换后弹出）移除，因此顺序不固定。
+     * 外观（精灵、音效）只保存索引，具体数据由ProjectileSystem按蓝图管理。
+     */
+    class ProjectilePool
+    {
+        engine::utils::Vec2SoA start_;           ///< @brief 起始位置
+        engine::utils::Vec2SoA target_position_; ///< @brief 目标位置
+        engine::utils::Vec2SoA position_;        ///< @brief 当前位置
+        engine::utils::Vec2SoA previous_;        ///< @brief 上一帧位置（用于计算朝向）
+        std::vector<float> arc_height_;          ///< @brief 弧线高度(即正弦函数振幅)
+        std::vector<float> flight_time_;         ///< @brief 总飞行时间
+        std::vector<float> elapsed_;             ///< @brief 当前飞行时间
+        std::vector<float> progress_;            ///< @brief 飞行进度 (0 ~ 1)，每帧计算
+        std::vector<float> rotation_;            ///< @brief 旋转角度（度）
+        std::vector<float> damage_;              ///< @brief 伤害
+        std::vector<entt::entity> target_;       ///< @brief 目标实体
+        std::vector<uint16_t> visual_;           ///< @brief 外观索引
+
+        std::vector<ProjectileArrival> arrivals_; ///< @brief 本帧到达的投射物
+        size_t peak_size_{0};                     ///< @brief 同时飞行的最大数量
+
+    public:
+        /**
+         * @brief 发射一个投射物
+         * @param visual 外观索引
+         * @param start_position 起始位置
+         * @param target_position 目标位置
+         * @param target 目标实体
+         * @param damage 伤害
+         * @param arc_height 弧线高度
+         * @param flight_time 总飞行时间
+         */
+        void spawn(uint16_t visual, const glm::vec2 &start_position, const glm::vec2 &target_position,
+                   entt::entity target, float damage, float arc_height, float flight_time);
+
+        /**
+         * @brief 更新所有投射物：累加飞行时间，移除到达终点的投射物，并批量计算位置与朝向
+         * @return 本帧到达终点的投射物（下次调用update前有效）
+         */
+        const std::vector<ProjectileArrival> &update(float delta_time);
+
+        void clear();
+
+        size_t size() const { return visual_.size(); }
+        size_t getPeakSize() const { return peak_size_; }
+        glm::vec2 getPosition(size_t index) const { return position_.get(index); }
+        float getRotation(size_t index) const { return rotation_[index]; }
+        uint16_t getVisual(size_t index) const { return visual_[index]; }
+
+    private:
+        void removeAt(size_t index); ///< @brief 交换删除指定索引的投射物
+    };
+
+}
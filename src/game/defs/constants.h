@@ -1,5 +1,6 @@
 #pragma once
 #include <glm/vec2.hpp>
+#include <cstddef>
 #include "../../engine/utils/math.h"
 namespace game::defs
 {
@@ -18,6 +19,13 @@ namespace game::defs
     constexpr glm::vec2 HEALTH_BAR_SIZE = {48.0f, 8.0f};       ///< @brief 血量条大小
     constexpr float HEALTH_BAR_OFFSET_Y = 8.0f;                ///< @brief 血量条竖直方向偏移量（水平方向默认正中间）
 
+    constexpr float SKILL_INITIAL_COOLDOWN_RATIO = 0.5f; ///< @brief 单位创建时技能已完成的冷却比例（初始冷却时间为技能冷却时间的一半）
+
+    constexpr size_t POOL_PREWARM_COUNT = 8; ///< @brief 每个蓝图预创建的池化实体数量（投射物、特效等）
+
+    constexpr size_t COMBAT_PHASE_EVENT_BUDGET = 1024; ///< @brief 战斗分发阶段（命中帧 -> 攻击/治疗/发射投射物）每次最多处理的事件数量
+    constexpr size_t EFFECT_PHASE_EVENT_BUDGET = 256;  ///< @brief 特效分发阶段（死亡特效、通用特效、移除单位）每次最多处理的事件数量
+
     /// @brief 玩家类型枚举
     enum class PlayerType
     {
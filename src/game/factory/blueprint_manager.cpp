@@ -1,5 +1,6 @@
 #include "blueprint_manager.h"
 #include "../../engine/resource/resource_manager.h"
+#include "../../engine/component/animation_component.h"
 #include <filesystem>
 #include <fstream>
 #include <nlohmann/json.hpp>
@@ -39,6 +40,8 @@ namespace game::factory
                 data::PlayerBlueprint player = parsePlayer(data_json);
                 // 解析DisplayInfo
                 data::DisplayInfoBlueprint display_info = parseDisplayInfo(data_json);
+                // 编译动画片段集合（同职业的所有实体共享）
+                auto clip_set = buildClipSet(animations, sprite);
                 // 解析完毕，组合蓝图并插入容器
                 player_class_blueprints_.emplace(class_id, data::PlayerClassBlueprint{class_id,
                                                                                       projectile_id,
@@ -48,7 +51,8 @@ namespace game::factory
                                                                                       std::move(sounds),
                                                                                       std::move(sprite),
                                                                                       std::move(display_info),
-                                                                                      std::move(animations)});
+                                                                                      std::move(animations),
+                                                                                      std::move(clip_set)});
             }
         }
         catch (const std::exception &e)
@@ -86,6 +90,8 @@ namespace game::factory
                 data::EnemyBlueprint enemy = parseEnemy(data_json);
                 // 解析DisplayInfo
                 data::DisplayInfoBlueprint display_info = parseDisplayInfo(data_json);
+                // 编译动画片段集合（同类型的所有敌人及其死亡特效共享）
+                auto clip_set = buildClipSet(animations, sprite);
                 // 解析完毕，组合蓝图并插入容器
                 enemy_class_blueprints_.emplace(class_id, data::EnemyClassBlueprint{class_id,
                                                                                     projectile_id,
@@ -95,7 +101,8 @@ namespace game::factory
                                                                                     std::move(sounds),
                                                                                     std::move(sprite),
                                                                                     std::move(display_info),
-                                                                                    std::move(animations)});
+                                                                                    std::move(animations),
+                                                                                    std::move(clip_set)});
             }
         }
         catch (const std::exception &e)
@@ -160,11 +167,14 @@ namespace game::factory
                 data::SpriteBlueprint sprite = parseSprite(data_json);
                 // 解析 Animation (单个动画)
                 data::AnimationBlueprint animation = parseOneAnimation(data_json);
+                // 编译动画片段集合 (只有一个片段，名称为特效id，默认不循环)
+                auto clip_set = buildClipSet({{id, animation}}, sprite, false);
                 // 解析完毕，组合蓝图并插入容器
                 effect_blueprints_.emplace(id, data::EffectBlueprint{id,
                                                                      name,
                                                                      std::move(sprite),
-                                                                     std::move(animation)});
+                                                                     std::move(animation),
+                                                                     std::move(clip_set)});
             }
         }
         catch (const std::exception &e)
@@ -334,7 +344,7 @@ namespace game::factory
 
         auto anim_data = json["animation"];
         std::vector<int> frames = anim_data["frames"].get<std::vector<int>>();
-        std::unordered_map<int, entt::id_type> events;
+        engine::utils::SmallFlatMap<int, entt::id_type> events;
         if (anim_data.contains("events"))
         {
             for (auto &[event_name, event_frame] : anim_data["events"].items())
@@ -348,6 +358,33 @@ namespace game::factory
                                         std::move(events)};
     }
 
+    std::shared_ptr<const engine::component::AnimationClipSet> BlueprintManager::buildClipSet(const std::unordered_map<entt::id_type, data::AnimationBlueprint> &animations,
+                                                                                             const data::SpriteBlueprint &sprite,
+                                                                                             bool loop)
+    {
+        auto clip_set = std::make_shared<engine::component::AnimationClipSet>();
+        // 针对每一个动画，
+        for (const auto &[anim_id, anim_blueprint] : animations)
+        {
+            // 创建动画帧容器
+            std::vector<engine::component::AnimationFrame> frames;
+            frames.reserve(anim_blueprint.frames_.size());
+            // 依次读取蓝图中的每一个帧索引
+            for (const auto &frame_index : anim_blueprint.frames_)
+            {
+                engine::utils::Rect source_rect = sprite.src_rect_;
+                // 通过索引计算每一帧的源矩形区域
+                source_rect.position.x += frame_index * source_rect.size.x;
+                source_rect.position.y += anim_blueprint.row_ * source_rect.size.y;
+                // 创建动画帧并插入动画帧容器
+                frames.emplace_back(source_rect, anim_blueprint.ms_per_frame_);
+            }
+            // 将动画帧写入片段集合 (可直接使用蓝图中的事件信息)
+            clip_set->addClip(anim_id, engine::component::Animation(std::move(frames), anim_blueprint.events_, loop));
+        }
+        return clip_set;
+    }
+
     data::SoundBlueprint BlueprintManager::parseSound(const nlohmann::json &json)
     {
         data::SoundBlueprint sounds;
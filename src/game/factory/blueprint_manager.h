@@ -2,6 +2,7 @@
 #include "../data/entity_blueprint.h"
 #include <string_view>
 #include <unordered_map>
+#include <memory>
 #include <entt/entity/fwd.hpp>
 #include <nlohmann/json_fwd.hpp>
 
@@ -53,6 +54,10 @@ namespace game::factory
         data::SpriteBlueprint parseSprite(const nlohmann::json &json);
         std::unordered_map<entt::id_type, data::AnimationBlueprint> parseAnimationsMap(const nlohmann::json &json);
         data::AnimationBlueprint parseOneAnimation(const nlohmann::json &json);
+        /// @brief 将动画蓝图编译为共享的动画片段集合（每个蓝图只编译一次）
+        std::shared_ptr<const engine::component::AnimationClipSet> buildClipSet(const std::unordered_map<entt::id_type, data::AnimationBlueprint> &animations,
+                                                                                 const data::SpriteBlueprint &sprite,
+                                                                                 bool loop = true);
         data::SoundBlueprint parseSound(const nlohmann::json &json);
         data::PlayerBlueprint parsePlayer(const nlohmann::json &json);
         data::EnemyBlueprint parseEnemy(const nlohmann::json &json);
@@ -18,6 +18,8 @@
 #include "../component/projectile_component.h"
 #include "../component/unit_prep_component.h"
 #include "../component/skill_component.h"
+#include "../component/pooled_component.h"
+#include "unit_prototypes.h"
 
 #include <entt/entity/registry.hpp>
 #include <entt/core/hashed_string.hpp>
@@ -32,11 +34,25 @@ namespace game::factory
 
     EntityFactory::EntityFactory(entt::registry &registry,
                                  BlueprintManager &blueprint_manager)
-        : registry_(registry), blueprint_manager_(blueprint_manager) {}
+        : registry_(registry),
+          blueprint_manager_(blueprint_manager),
+          entity_pool_(registry),
+          player_prototypes_(std::make_unique<UnitPrototypes>()),
+          enemy_prototypes_(std::make_unique<UnitPrototypes>()) {}
+
+    EntityFactory::~EntityFactory() = default;
 
     entt::entity EntityFactory::createPlayerUnit(entt::id_type class_id, const glm::vec2 &position, int level, int rarity)
     {
         auto entity = registry_.create();
+        // 已有相同（类型、等级、稀有度）的原型时直接克隆，只修改位置
+        const auto key = UnitPrototypes::makeKey(class_id, level, rarity);
+        if (player_prototypes_->instantiate(key, registry_, entity))
+        {
+            registry_.get<engine::component::TransformComponent>(entity).position_ = position;
+            return entity;
+        }
+
         const auto &blueprint = blueprint_manager_.getPlayerClassBlueprint(class_id);
         // --- 添加组件 ---
         // 添加Transform组件
@@ -46,7 +62,7 @@ namespace game::factory
         addSpriteComponent(entity, blueprint.sprite_);
 
         // 添加Animation组件
-        addAnimationComponent(entity, blueprint.animations_, blueprint.sprite_, "idle"_hs);
+        addAnimationComponent(entity, blueprint.clip_set_, "idle"_hs);
 
         // 添加Audio组件
         addAudioComponent(entity, blueprint.sounds_);
@@ -67,12 +83,24 @@ namespace game::factory
         registry_.emplace<game::component::ClassNameComponent>(entity, class_id, blueprint.display_info_.name_);
         registry_.emplace<engine::component::RenderComponent>(entity);
         registry_.emplace<game::defs::HasHealthBarTag>(entity);
+
+        // 保存为原型，之后的同类单位直接克隆
+        player_prototypes_->capture(key, registry_, entity);
         return entity;
     }
 
     entt::entity EntityFactory::createEnemyUnit(entt::id_type class_id, const glm::vec2 &position, int target_waypoint_id, int level, int rarity)
     {
         auto entity = registry_.create();
+        // 已有相同（类型、等级、稀有度）的原型时直接克隆，只修改位置与目标节点
+        const auto key = UnitPrototypes::makeKey(class_id, level, rarity);
+        if (enemy_prototypes_->instantiate(key, registry_, entity))
+        {
+            registry_.get<engine::component::TransformComponent>(entity).position_ = position;
+            registry_.get<game::component::EnemyComponent>(entity).target_waypoint_id_ = target_waypoint_id;
+            return entity;
+        }
+
         const auto &blueprint = blueprint_manager_.getEnemyClassBlueprint(class_id);
         // --- 添加组件 ---
         // 添加Transform组件
@@ -82,7 +110,7 @@ namespace game::factory
         addSpriteComponent(entity, blueprint.sprite_);
 
         // 添加Animation组件 (默认动画为“walk”)
-        addAnimationComponent(entity, blueprint.animations_, blueprint.sprite_, "walk"_hs);
+        addAnimationComponent(entity, blueprint.clip_set_, "walk"_hs);
 
         // 添加Audio组件
         addAudioComponent(entity, blueprint.sounds_);
@@ -101,35 +129,10 @@ namespace game::factory
         registry_.emplace<engine::component::RenderComponent>(entity); // 使用默认主图层
         registry_.emplace<game::defs::HasHealthBarTag>(entity);
 
-        // 未来可添加其它组件
+        // 未来可添加其它组件 (同时需要添加到UnitPrototypes的组件列表中)
 
-        return entity;
-    }
-
-    entt::entity EntityFactory::createProjectile(entt::id_type id, const glm::vec2 &start_position, const glm::vec2 &target_position, entt::entity target, float damage)
-    {
-        // 创建投射物实体
-        auto entity = registry_.create();
-        const auto &blueprint = blueprint_manager_.getProjectileBlueprint(id);
-        // --- 依次添加必要组件 ---
-        // 添加ProjectileComponent
-        registry_.emplace<game::component::ProjectileComponent>(entity,
-                                                                target,
-                                                                damage,
-                                                                start_position,
-                                                                target_position,
-                                                                start_position,
-                                                                blueprint.arc_height_,
-                                                                blueprint.total_flight_time_,
-                                                                0.0f);
-        // 添加SpriteComponent
-        addSpriteComponent(entity, blueprint.sprite_);
-        // 添加TransformComponent
-        addTransformComponent(entity, start_position);
-        // 添加AudioComponent
-        addAudioComponent(entity, blueprint.sounds_);
-        // 添加RenderComponent(让投射物位于主图层+1，即可以遮住角色)
-        registry_.emplace<engine::component::RenderComponent>(entity, engine::component::RenderComponent::MAIN_LAYER + 1);
+        // 保存为原型，之后的同类敌人直接克隆
+        enemy_prototypes_->capture(key, registry_, entity);
         return entity;
     }
 
@@ -157,16 +160,14 @@ namespace game::factory
 
     entt::entity EntityFactory::createEnemyDeadEffect(entt::id_type class_id, const glm::vec2 &position, const bool is_flipped)
     {
-        auto entity = registry_.create();
+        auto entity = acquirePooledEntity(game::component::PoolType::ENEMY_DEAD_EFFECT, class_id);
         const auto &blueprint = blueprint_manager_.getEnemyClassBlueprint(class_id);
-        // 添加Transform组件
-        addTransformComponent(entity, position);
-
-        // 添加Sprite组件
-        addSpriteComponent(entity, blueprint.sprite_, is_flipped);
+        // 重置Transform组件与翻转状态
+        registry_.emplace_or_replace<engine::component::TransformComponent>(entity, position);
+        registry_.get<engine::component::SpriteComponent>(entity).sprite_.is_flipped_ = is_flipped;
 
-        // 添加Animation组件(死亡动画名称为“damage”)
-        addOneAnimationComponent(entity, blueprint.animations_.at("damage"_hs), blueprint.sprite_, "damage"_hs);
+        // 添加Animation组件(共享敌人的动画片段集合，播放一次“damage”动画)
+        addAnimationComponent(entity, blueprint.clip_set_, "damage"_hs, false);
 
         // 补充其他必要组件
         registry_.emplace<engine::component::RenderComponent>(entity);
@@ -176,16 +177,14 @@ namespace game::factory
 
     entt::entity EntityFactory::createEffect(entt::id_type effect_id, const glm::vec2 &position, const bool is_flipped)
     {
-        auto entity = registry_.create();
+        auto entity = acquirePooledEntity(game::component::PoolType::EFFECT, effect_id);
         const auto &blueprint = blueprint_manager_.getEffectBlueprint(effect_id);
-        // 添加Transform组件
-        addTransformComponent(entity, position);
-
-        // 添加Sprite组件
-        addSpriteComponent(entity, blueprint.sprite_, is_flipped);
+        // 重置Transform组件与翻转状态
+        registry_.emplace_or_replace<engine::component::TransformComponent>(entity, position);
+        registry_.get<engine::component::SpriteComponent>(entity).sprite_.is_flipped_ = is_flipped;
 
         // 添加Animation组件, 只有一个动画，名称为特效id
-        addOneAnimationComponent(entity, blueprint.animation_, blueprint.sprite_, effect_id);
+        addAnimationComponent(entity, blueprint.clip_set_, effect_id, false);
 
         // 补充其他必要组件
         registry_.emplace<engine::component::RenderComponent>(entity, engine::component::RenderComponent::MAIN_LAYER + 10);
@@ -195,19 +194,67 @@ namespace game::factory
 
     entt::entity EntityFactory::createSkillDisplay(entt::id_type effect_id, const glm::vec2 &position)
     {
-        auto entity = registry_.create();
+        auto entity = acquirePooledEntity(game::component::PoolType::SKILL_DISPLAY, effect_id);
         const auto &effect_blueprint = blueprint_manager_.getEffectBlueprint(effect_id);
-        // 添加Transform组件
-        addTransformComponent(entity, position);
-        // 添加Sprite组件
-        addSpriteComponent(entity, effect_blueprint.sprite_);
+        // 重置Transform组件
+        registry_.emplace_or_replace<engine::component::TransformComponent>(entity, position);
         // 添加Animation组件 (角色上方的技能标识，循环播放)
-        addOneAnimationComponent(entity, effect_blueprint.animation_, effect_blueprint.sprite_, effect_id, true);
+        addAnimationComponent(entity, effect_blueprint.clip_set_, effect_id, true);
         // 补充其他必要组件
         registry_.emplace<engine::component::RenderComponent>(entity, engine::component::RenderComponent::MAIN_LAYER + 20);
         return entity;
     }
 
+    void EntityFactory::prewarmPools(size_t count)
+    {
+        // 为每个蓝图预先创建闲置实体，战斗中直接复用
+        for (const auto &[id, blueprint] : blueprint_manager_.effect_blueprints_)
+        {
+            prewarmPool(game::component::PoolType::EFFECT, id, count);
+            prewarmPool(game::component::PoolType::SKILL_DISPLAY, id, count);
+        }
+        for (const auto &[id, blueprint] : blueprint_manager_.enemy_class_blueprints_)
+        {
+            prewarmPool(game::component::PoolType::ENEMY_DEAD_EFFECT, id, count);
+        }
+        entity_pool_.resetStats(); // 预热不计入统计
+        spdlog::info("Entity pools prewarmed, {} entities per blueprint", count);
+    }
+
+    void EntityFactory::prewarmPool(game::component::PoolType type, entt::id_type id, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            entity_pool_.release(createPooledEntity(type, id));
+        }
+    }
+
+    entt::entity EntityFactory::acquirePooledEntity(game::component::PoolType type, entt::id_type id)
+    {
+        auto entity = entity_pool_.acquire(type, id);
+        return entity != entt::null ? entity : createPooledEntity(type, id);
+    }
+
+    entt::entity EntityFactory::createPooledEntity(game::component::PoolType type, entt::id_type id)
+    {
+        // 只添加不随激活变化的组件（精灵、音效），其它组件在每次激活时添加
+        auto entity = registry_.create();
+        switch (type)
+        {
+        case game::component::PoolType::EFFECT:
+        case game::component::PoolType::SKILL_DISPLAY:
+            addSpriteComponent(entity, blueprint_manager_.getEffectBlueprint(id).sprite_);
+            break;
+        case game::component::PoolType::ENEMY_DEAD_EFFECT:
+            addSpriteComponent(entity, blueprint_manager_.getEnemyClassBlueprint(id).sprite_);
+            break;
+        default:
+            break;
+        }
+        registry_.emplace<game::component::PooledComponent>(entity, type, id);
+        return entity;
+    }
+
     void EntityFactory::addTransformComponent(entt::entity entity, const glm::vec2 &position, const glm::vec2 &scale, float rotation)
     {
         registry_.emplace<engine::component::TransformComponent>(entity, position, scale, rotation);
@@ -229,56 +276,22 @@ namespace game::factory
     }
 
     void EntityFactory::addAnimationComponent(entt::entity entity,
-                                              const std::unordered_map<entt::id_type, data::AnimationBlueprint> &animation_blueprints,
-                                              const data::SpriteBlueprint &sprite_blueprint,
-                                              entt::id_type default_animation_id)
+                                              const std::shared_ptr<const engine::component::AnimationClipSet> &clip_set,
+                                              entt::id_type animation_id,
+                                              bool loop)
     {
-        // 先创建map容器
-        std::unordered_map<entt::id_type, engine::component::Animation> animations;
-        // 针对每一个动画，
-        for (const auto &[anim_id, anim_blueprint] : animation_blueprints)
+        // 动画帧数据在蓝图加载时已编译为共享的片段集合，组件只保存播放状态
+        auto &animation = registry_.emplace<engine::component::AnimationComponent>(entity, clip_set, animation_id);
+        animation.loop_ = loop;
+        // 精灵立即显示片段的第一帧（从对象池取出的实体还保留着上次播放的最后一帧，
+        // 而特效可能在动画系统更新之后、渲染之前创建）
+        if (auto *sprite = registry_.try_get<engine::component::SpriteComponent>(entity);
+            sprite && animation.hasClip())
         {
-            // 创建动画帧容器
-            std::vector<engine::component::AnimationFrame> frames;
-            // 依次读取蓝图中的每一个帧索引
-            for (const auto &frame_index : anim_blueprint.frames_)
-            {
-                engine::utils::Rect source_rect = sprite_blueprint.src_rect_;
-                // 通过索引计算每一帧的源矩形区域
-                source_rect.position.x += frame_index * source_rect.size.x;
-                source_rect.position.y += anim_blueprint.row_ * source_rect.size.y;
-                // 创建动画帧并插入动画帧容器
-                frames.emplace_back(source_rect, anim_blueprint.ms_per_frame_);
-            }
-            // 将创建好的动画帧容器插入动画map容器 (可直接使用蓝图中的事件信息)
-            animations.emplace(anim_id, engine::component::Animation(std::move(frames), anim_blueprint.events_));
+            const auto &clip = clip_set->getClip(animation.current_clip_index_);
+            if (clip.frame_count_ > 0)
+                sprite->sprite_.src_rect_ = clip_set->getFrame(clip, 0).src_rect_;
         }
-        // 通过动画map容器创建动画组件
-        registry_.emplace<engine::component::AnimationComponent>(entity, std::move(animations), default_animation_id);
-    }
-
-    void EntityFactory::addOneAnimationComponent(entt::entity entity,
-                                                 const data::AnimationBlueprint &animation_blueprint,
-                                                 const data::SpriteBlueprint &sprite_blueprint,
-                                                 entt::id_type animation_id,
-                                                 bool loop)
-    {
-        // 创建动画帧容器
-        std::vector<engine::component::AnimationFrame> frames;
-        // 依次读取动画蓝图中每一个动画帧，并插入容器
-        for (const auto &frame_index : animation_blueprint.frames_)
-        {
-            engine::utils::Rect source_rect = sprite_blueprint.src_rect_;
-            source_rect.position.x += frame_index * source_rect.size.x;
-            source_rect.position.y += animation_blueprint.row_ * source_rect.size.y;
-            frames.emplace_back(source_rect, animation_blueprint.ms_per_frame_);
-        }
-        // 创建动画map容器
-        std::unordered_map<entt::id_type, engine::component::Animation> animations;
-        // 将创建好的动画帧容器插入动画map容器 (只有一个动画)
-        animations.emplace(animation_id, engine::component::Animation(std::move(frames), animation_blueprint.events_, loop));
-        // 通过动画map容器创建动画组件
-        registry_.emplace<engine::component::AnimationComponent>(entity, std::move(animations), animation_id);
     }
 
     void EntityFactory::addStatsComponent(entt::entity entity, const data::StatsBlueprint &stats, int level, int rarity)
@@ -339,13 +352,8 @@ namespace game::factory
     {
         if (sounds.sounds_.empty())
             return;
-        // 将sounds_中的键值对转换为audio_map中的键值对
-        std::unordered_map<entt::id_type, entt::id_type> audio_map;
-        for (const auto &[sound_key, sound_id] : sounds.sounds_)
-        {
-            audio_map.emplace(sound_key, sound_id);
-        }
-        registry_.emplace<engine::component::AudioComponent>(entity, std::move(audio_map));
+        // 蓝图与组件使用相同的扁平映射，直接拷贝（元素较少时不需要堆分配）
+        registry_.emplace<engine::component::AudioComponent>(entity, sounds.sounds_);
     }
 
     void EntityFactory::addProjectileIDComponent(entt::entity entity, entt::id_type id)
@@ -364,7 +372,7 @@ namespace game::factory
                                                            skill.description_,
                                                            skill.cooldown_,
                                                            skill.duration_,
-                                                           skill.cooldown_ / 2.0f, // 初始技能冷却时间为技能冷却时间的一半
+                                                           0.0f, // 计时开始时间由TimerSystem在组件构造时设置
                                                            0.0f);
         // 如果是被动技能，则添加PassiveSkillTag与SkillReadyTag
         if (skill.passive_)
@@ -1,13 +1,16 @@
 #pragma once
 #include "../data/entity_blueprint.h"
+#include "entity_pool.h"
 #include <entt/entity/fwd.hpp>
 #include <unordered_map>
+#include <memory>
 #include <nlohmann/json.hpp>
 
 namespace game::factory
 {
 
     class BlueprintManager;
+    struct UnitPrototypes;
     /**
      * @brief 实体工厂，用于创建不同类型的实体
      *
@@ -18,17 +21,21 @@ namespace game::factory
     private:
         entt::registry &registry_;
         BlueprintManager &blueprint_manager_;
+        EntityPool entity_pool_;                            ///< @brief 短生命周期实体（特效、技能标识）的对象池
+        std::unique_ptr<UnitPrototypes> player_prototypes_; ///< @brief 玩家单位原型（按类型、等级、稀有度）
+        std::unique_ptr<UnitPrototypes> enemy_prototypes_;  ///< @brief 敌人单位原型（按类型、等级、稀有度）
 
     public:
         /// @brief 实体工厂构造函数, 需要传入注册表和蓝图管理器。通过蓝图数据创建不同实体
         EntityFactory(entt::registry &registry, BlueprintManager &blueprint_manager);
+        ~EntityFactory();
 
+        /// @brief 创建玩家单位，同一（类型、等级、稀有度）第一次创建时按蓝图构建并保存为原型，之后直接克隆原型
         entt::entity createPlayerUnit(entt::id_type class_id, const glm::vec2 &position, int level = 1, int rarity = 1);
 
+        /// @brief 创建敌人单位，同样使用原型克隆（只修改位置与目标节点）
         entt::entity createEnemyUnit(entt::id_type class_id, const glm::vec2 &position, int target_waypoint_id, int level = 1, int rarity = 1);
 
-        entt::entity createProjectile(entt::id_type id, const glm::vec2 &start_position, const glm::vec2 &target_position, entt::entity target, float damage);
-
         /**
          * @brief 创建单位准备类型实体
          * @param name_id 单位名称ID
@@ -66,19 +73,30 @@ namespace game::factory
          */
         entt::entity createSkillDisplay(entt::id_type effect_id, const glm::vec2 &position);
 
+        /**
+         * @brief 为所有特效、敌人死亡特效蓝图预先创建闲置实体
+         * @param count 每个蓝图（每种用途）预创建的实体数量
+         */
+        void prewarmPools(size_t count = game::defs::POOL_PREWARM_COUNT);
+
+        /// @brief 回收池化实体（由RemoveDeadSystem调用），不是池化实体时返回false
+        bool recycle(entt::entity entity) { return entity_pool_.release(entity); }
+
+        EntityPool &getEntityPool() { return entity_pool_; }
+
     private:
+        // --- 对象池相关 ---
+        void prewarmPool(game::component::PoolType type, entt::id_type id, size_t count);
+        entt::entity acquirePooledEntity(game::component::PoolType type, entt::id_type id); ///< @brief 从池中取出实体，池为空时新建
+        entt::entity createPooledEntity(game::component::PoolType type, entt::id_type id);  ///< @brief 新建只带有静态组件（精灵、音效）的池化实体
+
         // --- 组件创建函数 ---
         void addTransformComponent(entt::entity entity, const glm::vec2 &position, const glm::vec2 &scale = glm::vec2(1.0f), float rotation = 0.0f);
         void addSpriteComponent(entt::entity entity, const data::SpriteBlueprint &sprite, const bool is_flipped = false);
-        void addAnimationComponent(entt::entity entity,
-                                   const std::unordered_map<entt::id_type, data::AnimationBlueprint> &animation_blueprints,
-                                   const data::SpriteBlueprint &sprite_blueprint,
-                                   entt::id_type default_animation_id);
-        void addOneAnimationComponent(entt::entity entity, ///< @brief 单个动画组件添加（组件中只包含一个动画），用于创建特效
-                                      const data::AnimationBlueprint &animation_blueprint,
-                                      const data::SpriteBlueprint &sprite_blueprint,
-                                      entt::id_type animation_id,
-                                      bool loop = false);
+        void addAnimationComponent(entt::entity entity, ///< @brief 添加动画组件（共享蓝图中已编译的动画片段集合）
+                                   const std::shared_ptr<const engine::component::AnimationClipSet> &clip_set,
+                                   entt::id_type animation_id,
+                                   bool loop = true);
         void addStatsComponent(entt::entity entity, const data::StatsBlueprint &stats, int level = 1, int rarity = 1);
         void addPlayerComponent(entt::entity entity, const data::PlayerBlueprint &player, int rarity);
         void addEnemyComponent(entt::entity entity, const data::EnemyBlueprint &enemy, int target_waypoint_id);
@@ -0,0 +1,75 @@
+#include "entity_pool.h"
+#include "../defs/tags.h"
+#include "../../engine/component/render_component.h"
+#include "../../engine/component/animation_component.h"
+#include <entt/entity/registry.hpp>
+
+namespace game::factory
+{
+
+    EntityPool::EntityPool(entt::registry &registry)
+        : registry_(registry) {}
+
+    entt::entity EntityPool::acquire(game::component::PoolType type, entt::id_type id)
+    {
+        auto &stats = stats_[static_cast<size_t>(type)];
+        auto &free_list = free_lists_[static_cast<size_t>(type)];
+        if (auto it = free_list.find(id); it != free_list.end() && !it->second.empty())
+        {
+            auto entity = it->second.back();
+            it->second.pop_back();
+            ++stats.hits_;
+            --stats.available_;
+            return entity;
+        }
+        ++stats.misses_;
+        return entt::null;
+    }
+
+    bool EntityPool::release(entt::entity entity)
+    {
+        if (!registry_.valid(entity))
+            return false;
+        auto pooled = registry_.try_get<game::component::PooledComponent>(entity);
+        if (!pooled)
+            return false;
+
+        // 移除“激活”相关的组件和标签，闲置实体不会被任何系统处理
+        registry_.remove<game::defs::DeadTag,
+                         game::defs::OneShotRemoveTag,
+                         engine::component::RenderComponent,
+                         engine::component::AnimationComponent>(entity);
+
+        auto &stats = stats_[static_cast<size_t>(pooled->type_)];
+        free_lists_[static_cast<size_t>(pooled->type_)][pooled->id_].push_back(entity);
+        ++stats.released_;
+        ++stats.available_;
+        return true;
+    }
+
+    void EntityPool::resetStats()
+    {
+        for (auto &stats : stats_)
+        {
+            stats.hits_ = 0;
+            stats.misses_ = 0;
+            stats.released_ = 0;
+        }
+    }
+
+    const char *EntityPool::getTypeName(game::component::PoolType type)
+    {
+        switch (type)
+        {
+        case game::component::PoolType::EFFECT:
+            return "特效";
+        case game::component::PoolType::ENEMY_DEAD_EFFECT:
+            return "敌人死亡特效";
+        case game::component::PoolType::SKILL_DISPLAY:
+            return "技能标识";
+        default:
+            return "未知";
+        }
+    }
+
+}
@@ -0,0 +1,59 @@
+#pragma once
+#include "../component/pooled_component.h"
+#include <entt/entity/fwd.hpp>
+#include <array>
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+namespace game::factory
+{
+
+    /// @brief 单个对象池类型的统计数据
+    struct PoolStats
+    {
+        size_t hits_{0};      ///< @brief 从池中取到实体的次数
+        size_t misses_{0};    ///< @brief 池为空、需要新建实体的次数
+        size_t released_{0};  ///< @brief 回收到池中的次数
+        size_t available_{0}; ///< @brief 当前池中闲置的实体数量
+    };
+
+    /**
+     * @brief 实体对象池，管理短生命周期实体（特效、死亡特效、技能标识）的闲置实体
+     *
+     * 闲置实体保留创建开销较大的组件（精灵、音效等），只移除“激活”相关的组件（渲染、动画等），
+     * 因此不会被任何系统处理。重新激活时由EntityFactory重置这些组件。
+     */
+    class EntityPool
+    {
+        using FreeList = std::unordered_map<entt::id_type, std::vector<entt::entity>>; ///< @brief 蓝图ID -> 闲置实体
+
+        entt::registry &registry_;
+        std::array<FreeList, static_cast<size_t>(game::component::PoolType::COUNT)> free_lists_;
+        std::array<PoolStats, static_cast<size_t>(game::component::PoolType::COUNT)> stats_;
+
+    public:
+        EntityPool(entt::registry &registry);
+
+        /**
+         * @brief 从池中取出一个闲置实体
+         * @param type 对象池类型
+         * @param id 蓝图ID
+         * @return 闲置实体，池为空时返回entt::null（计为一次未命中）
+         */
+        [[nodiscard]] entt::entity acquire(game::component::PoolType type, entt::id_type id);
+
+        /**
+         * @brief 停用实体并放回对应的对象池
+         * @param entity 带有PooledComponent的实体
+         * @return true 回收成功，false 实体无效或不是池化实体
+         */
+        bool release(entt::entity entity);
+
+        const PoolStats &getStats(game::component::PoolType type) const { return stats_[static_cast<size_t>(type)]; }
+        void resetStats(); ///< @brief 清零命中/未命中/回收计数（闲置数量保持不变）
+
+        static const char *getTypeName(game::component::PoolType type); ///< @brief 获取对象池类型名称（用于调试UI）
+    };
+
+}
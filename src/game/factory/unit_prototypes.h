@@ -0,0 +1,59 @@
+#pragma once
+#include "../defs/tags.h"
+#include "../component/stats_component.h"
+#include "../component/enemy_component.h"
+#include "../component/class_name_component.h"
+#include "../component/player_component.h"
+#include "../component/blocker_component.h"
+#include "../component/projectile_component.h"
+#include "../component/skill_component.h"
+#include "../../engine/scene/prototype_registry.h"
+#include "../../engine/component/transform_component.h"
+#include "../../engine/component/sprite_component.h"
+#include "../../engine/component/animation_component.h"
+#include "../../engine/component/velocity_component.h"
+#include "../../engine/component/render_component.h"
+#include "../../engine/component/audio_component.h"
+#include <entt/entity/entity.hpp>
+#include <cstdint>
+
+namespace game::factory
+{
+
+    /**
+     * @brief 玩家/敌人单位的原型注册表，每个（类型、等级、稀有度）组合保存一个原型
+     *
+     * 第一次创建某个组合的单位时按蓝图构建并保存为原型，之后直接克隆原型，只修改位置、目标节点等字段。
+     * @note 组件列表需要覆盖EntityFactory::createPlayerUnit/createEnemyUnit添加的所有组件，新增单位组件时需同步添加
+     */
+    struct UnitPrototypes : engine::scene::PrototypeRegistry<engine::component::TransformComponent,
+                                                             engine::component::SpriteComponent,
+                                                             engine::component::AnimationComponent,
+                                                             engine::component::AudioComponent,
+                                                             engine::component::VelocityComponent,
+                                                             engine::component::RenderComponent,
+                                                             game::component::StatsComponent,
+                                                             game::component::EnemyComponent,
+                                                             game::component::PlayerComponent,
+                                                             game::component::BlockerComponent,
+                                                             game::component::ProjectileIDComponent,
+                                                             game::component::SkillComponent,
+                                                             game::component::ClassNameComponent,
+                                                             game::defs::FaceLeftTag,
+                                                             game::defs::MeleeUnitTag,
+                                                             game::defs::RangedUnitTag,
+                                                             game::defs::HealerTag,
+                                                             game::defs::HasHealthBarTag,
+                                                             game::defs::PassiveSkillTag,
+                                                             game::defs::SkillReadyTag>
+    {
+        /// @brief 生成原型键（类型ID占高32位，等级与稀有度各占16位）
+        static uint64_t makeKey(entt::id_type class_id, int level, int rarity)
+        {
+            return (static_cast<uint64_t>(class_id) << 32) |
+                   (static_cast<uint64_t>(static_cast<uint16_t>(level)) << 16) |
+                   static_cast<uint16_t>(rarity);
+        }
+    };
+
+}
@@ -3,7 +3,7 @@
 #include "../defs/tags.h"
 #include "../../engine/component/tilelayer_component.h"
 #include <nlohmann/json.hpp>
-#include <spdlog/spdlog.h>
+#include "../../engine/utils/log.h"
 game::loader::EntityBuilderMW::EntityBuilderMW(engine::loader::LevelLoader &level_loader, engine::core::Context &context, entt::registry &registry, std::unordered_map<int, data::WaypointNode> &waypoint_nodes, std::vector<int> &start_points)
     : engine::loader::BasicEntityBuilder(level_loader, context, registry), waypoint_nodes_(waypoint_nodes), start_points_(start_points)
 {
@@ -56,7 +56,7 @@ void game::loader::EntityBuilderMW::buildPath()
     }
     // 添加到节点容器中
     waypoint_nodes_[id] = game::data::WaypointNode{id, std::move(position), std::move(next_node_ids)};
-    spdlog::trace("waypoint_nodes_ size: {}", waypoint_nodes_.size());
+    MW_LOG_TRACE(LOADER, "waypoint_nodes_ size: {}", waypoint_nodes_.size());
 }
 
 void game::loader::EntityBuilderMW::buildPlace()
@@ -8,9 +8,13 @@
 // engine - core
 #include "../../engine/core/context.h"
 #include "../../engine/utils/events.h"
+#include "../../engine/utils/dispatcher_profiler.h"
+#include "../../engine/utils/frame_arena.h"
+#include "../../engine/utils/alloc_tracker.h"
 #include "../../engine/audio/audio_player.h"
 #include "../../engine/resource/resource_manager.h"
 #include "../../engine/loader/level_loader.h"
+#include "../../engine/loader/level_preloader.h"
 #include "../../engine/core/game_state.h"
 
 // engine - render & ui
@@ -33,6 +37,8 @@
 #include "../../engine/audio/audio_player.h"
 
 // game - component & defs
+#include "../data/dead_queue.h"
+#include "../defs/constants.h"
 #include "../component/enemy_component.h"
 #include "../spawner/enemy_spawner.h"
 #include "title_scene.h"
@@ -47,6 +53,7 @@
 #include "../system/attack_starter_system.h"
 #include "../system/timer_system.h"
 #include "../system/orientation_system.h"
+#include "../system/movement_groups.h"
 #include "../system/animation_state_system.h"
 #include "../system/animation_event_system.h"
 #include "../system/combat_resolve_system.h"
@@ -72,12 +79,16 @@ game::scene::GameScene::GameScene(engine::core::Context &context,
                                   std::shared_ptr<game::factory::BlueprintManager> blueprint_manager,
                                   std::shared_ptr<game::data::SessionData> session_data,
                                   std::shared_ptr<game::data::UIConfig> ui_config,
-                                  std::shared_ptr<game::data::LevelConfig> level_config)
+                                  std::shared_ptr<game::data::LevelConfig> level_config,
+                                  std::shared_ptr<game::data::LevelSnapshot> level_snapshot,
+                                  std::shared_ptr<engine::loader::LevelPreloader> level_preloader)
     : engine::scene::Scene("GameScene", context),
       blueprint_manager_(blueprint_manager),
       session_data_(session_data),
       ui_config_(ui_config),
-      level_config_(level_config)
+      level_config_(level_config),
+      level_snapshot_(level_snapshot),
+      level_preloader_(level_preloader)
 {
 }
 
@@ -151,37 +162,49 @@ void game::scene::GameScene::update(float dt)
 {
     auto &dispatcher = context_.getDispatcher();
 
+    // 批量结算上一帧末分发的攻击/治疗事件（大部分已在本帧的战斗分发阶段结算），死亡的实体紧接着被清理
+    { MW_ALLOC_SCOPE("combat_resolve"); combat_resolve_system_->update(); }
     // 每一帧最先清理死亡实体(要在dispatcher处理完事件后再清理，因此放在下一帧开头)
-    remove_dead_system_->update(registry_);
+    { MW_ALLOC_SCOPE("remove_dead"); remove_dead_system_->update(registry_); }
+    // 播放上一帧分发的音效（同帧相同音效已合并）
+    { MW_ALLOC_SCOPE("audio"); audio_system_->update(); }
 
     // 暂停状态下，有些功能依然正常运行
     if (context_.getGameState().isPaused())
     {
-        place_unit_system_->update(dt);
-        ysort_system_->update(registry_);
-        selection_system_->update();
-        units_portrait_ui_->update(dt);
-        Scene::update(dt);
+        { MW_ALLOC_SCOPE("place_unit"); place_unit_system_->update(dt); }
+        { MW_ALLOC_SCOPE("ysort"); ysort_system_->update(registry_); }
+        { MW_ALLOC_SCOPE("selection"); selection_system_->update(); }
+        { MW_ALLOC_SCOPE("units_portrait_ui"); units_portrait_ui_->update(dt); }
+        { MW_ALLOC_SCOPE("ui"); Scene::update(dt); }
         return;
     }
 
-    timer_system_->update(dt);
-    game_rule_system_->update(dt);
-    block_system_->update(registry_, dispatcher);
-    set_target_system_->update(registry_);
-
-    follow_path_system_->update(registry_, dispatcher, waypoint_nodes_);
-    orientation_system_->update(registry_);
-    attack_starter_system_->update(registry_, dispatcher);
-    projectile_system_->update(dt);
-    movement_system_->update(registry_, dt);
-    animation_system_->update(dt);
-    place_unit_system_->update(dt);
-    ysort_system_->update(registry_);
-    selection_system_->update();
-    enemy_spawner_->update(dt);
-    units_portrait_ui_->update(dt);
-    Scene::update(dt);
+    { MW_ALLOC_SCOPE("timer"); timer_system_->update(dt); }
+    { MW_ALLOC_SCOPE("game_rule"); game_rule_system_->update(dt); }
+    { MW_ALLOC_SCOPE("block"); block_system_->update(registry_, dispatcher); }
+    { MW_ALLOC_SCOPE("set_target"); set_target_system_->update(registry_); }
+
+    { MW_ALLOC_SCOPE("follow_path"); follow_path_system_->update(registry_, dispatcher, waypoint_nodes_); }
+    { MW_ALLOC_SCOPE("orientation"); orientation_system_->update(registry_); }
+    { MW_ALLOC_SCOPE("attack_starter"); attack_starter_system_->update(registry_, dispatcher); }
+    { MW_ALLOC_SCOPE("projectile"); projectile_system_->update(dt); }
+    { MW_ALLOC_SCOPE("movement"); movement_system_->update(registry_, dt); }
+    { MW_ALLOC_SCOPE("animation"); animation_system_->update(dt); }
+    // 立即分发本帧产生的命中帧/攻击事件并结算伤害，死亡产生的特效事件也在本帧处理（剩余事件仍在帧末分发）
+    auto &profiler = context_.getDispatcherProfiler();
+    {
+        MW_ALLOC_SCOPE("combat_phase");
+        profiler.flush("combat"_hs);
+        combat_resolve_system_->update();
+        profiler.flush("effects"_hs);
+    }
+    { MW_ALLOC_SCOPE("place_unit"); place_unit_system_->update(dt); }
+    { MW_ALLOC_SCOPE("ysort"); ysort_system_->update(registry_); }
+    { MW_ALLOC_SCOPE("selection"); selection_system_->update(); }
+    { MW_ALLOC_SCOPE("enemy_spawner"); enemy_spawner_->update(dt); }
+    { MW_ALLOC_SCOPE("units_portrait_ui"); units_portrait_ui_->update(dt); }
+    { MW_ALLOC_SCOPE("ui"); Scene::update(dt); }
 }
 
 void game::scene::GameScene::render()
@@ -256,20 +279,62 @@ bool game::scene::GameScene::initUIConfig()
 
 bool game::scene::GameScene::loadlevel()
 {
+    // 重开同一关卡时，直接从快照恢复，跳过地图解析和实体创建
+    if (restoreLevelSnapshot())
+    {
+        return true;
+    }
+
     engine::loader::LevelLoader level_loader;
 
     level_loader.setEntityBuilder(std::make_unique<game::loader::EntityBuilderMW>(level_loader, context_, registry_, waypoint_nodes_, start_points_));
     // 获取关卡地图路径
     auto map_path = level_config_->getMapPath(level_number_);
-    if (!level_loader.loadLevel(map_path, this))
+    // 如果地图数据已在后台预加载完成，只需在主线程创建实体；否则同步加载
+    std::optional<engine::loader::LevelBinary> preloaded;
+    if (level_preloader_)
+    {
+        preloaded = level_preloader_->take(map_path);
+        level_preloader_.reset();
+    }
+    const bool loaded = preloaded ? level_loader.loadLevel(std::move(*preloaded), map_path, this)
+                                  : level_loader.loadLevel(map_path, this);
+    if (!loaded)
     {
         spdlog::error("Failed to load level");
         return false;
     }
 
+    captureLevelSnapshot();
+    return true;
+}
+
+bool game::scene::GameScene::restoreLevelSnapshot()
+{
+    if (!level_snapshot_ || !level_snapshot_->isValidFor(level_number_))
+        return false;
+    if (!level_snapshot_->registry_.restore(registry_))
+    {
+        spdlog::warn("Failed to restore level snapshot, reloading level {}", level_number_);
+        registry_.clear();
+        return false;
+    }
+    waypoint_nodes_ = level_snapshot_->waypoint_nodes_;
+    start_points_ = level_snapshot_->start_points_;
+    spdlog::info("Level {} restored from snapshot ({} entities)", level_number_, level_snapshot_->registry_.getEntityCount());
     return true;
 }
 
+void game::scene::GameScene::captureLevelSnapshot()
+{
+    // 快照与其它共享数据一样在场景间传递；新关卡（或首次加载）时重新创建
+    level_snapshot_ = std::make_shared<game::data::LevelSnapshot>();
+    level_snapshot_->level_number_ = level_number_;
+    level_snapshot_->registry_.capture(registry_);
+    level_snapshot_->waypoint_nodes_ = waypoint_nodes_;
+    level_snapshot_->start_points_ = start_points_;
+}
+
 bool game::scene::GameScene::initEventConnections()
 {
     auto &dispatcher = context_.getDispatcher();
@@ -278,6 +343,16 @@ bool game::scene::GameScene::initEventConnections()
     dispatcher.sink<game::defs::SaveEvent>().connect<&GameScene::onSave>(this);
     dispatcher.sink<game::defs::LevelClearEvent>().connect<&GameScene::onLevelClear>(this);
     dispatcher.sink<game::defs::GameEndEvent>().connect<&GameScene::onGameEndEvent>(this);
+
+    // 场景更新中途的分发阶段（见update），让“命中 -> 伤害 -> 死亡 -> 特效”在同一帧内完成
+    auto &profiler = context_.getDispatcherProfiler();
+    profiler.definePhase<engine::utils::AnimationEvent,
+                         game::defs::AttackEvent,
+                         game::defs::HealEvent,
+                         game::defs::EmitProjectileEvent>("combat"_hs, "战斗", game::defs::COMBAT_PHASE_EVENT_BUDGET);
+    profiler.definePhase<game::defs::EnemyDeadEffectEvent,
+                         game::defs::EffectEvent,
+                         game::defs::RemovePlayerUnitEvent>("effects"_hs, "特效", game::defs::EFFECT_PHASE_EVENT_BUDGET);
     return true;
 }
 
@@ -305,6 +380,8 @@ bool game::scene::GameScene::initEntityFactory()
         }
     }
     entity_factory_ = std::make_unique<game::factory::EntityFactory>(registry_, *blueprint_manager_);
+    // 预先创建投射物、特效等短生命周期实体，战斗中从对象池复用
+    entity_factory_->prewarmPools();
     spdlog::info("entity_factory_ created");
     return true;
 }
@@ -319,11 +396,16 @@ bool game::scene::GameScene::initRegistryContext()
     registry_.ctx().emplace<std::unordered_map<int, game::data::WaypointNode> &>(waypoint_nodes_);
     registry_.ctx().emplace<std::vector<int> &>(start_points_);
     registry_.ctx().emplace<game::data::GameStats &>(game_stats_);
+    registry_.ctx().emplace<game::data::DeadQueue>(); // 延迟销毁队列（通过game::data::markDead使用）
     registry_.ctx().emplace<game::data::Waves &>(waves_);
     registry_.ctx().emplace<int &>(level_number_);
+    registry_.ctx().emplace<game::factory::EntityPool &>(entity_factory_->getEntityPool());
+    registry_.ctx().emplace<engine::utils::FrameArena &>(context_.getFrameArena()); // 帧内存（系统内的临时容器使用）
     registry_.ctx().emplace_as<entt::entity &>("selected_unit"_hs, selected_unit_);
     registry_.ctx().emplace_as<entt::entity &>("hovered_unit"_hs, hovered_unit_);
     registry_.ctx().emplace_as<bool &>("show_save_panel"_hs, show_save_panel_);
+    // 声明速度 + 变换的 owning group（此后这两种组件按group顺序紧密排列），以及寻路、阻挡、朝向系统使用的 non-owning group
+    game::system::declareMovementGroups(registry_);
     spdlog::info("registry_ context initialized");
     return true;
 }
@@ -350,7 +432,8 @@ void game::scene::GameScene::onRestart()
         blueprint_manager_,
         session_data_,
         ui_config_,
-        level_config_));
+        level_config_,
+        level_snapshot_));
 }
 
 void game::scene::GameScene::onBackToTitle()
@@ -406,7 +489,7 @@ bool game::scene::GameScene::initSystems()
     audio_system_ = std::make_unique<engine::system::AudioSystem>(registry_, context_);
 
     follow_path_system_ = std::make_unique<game::system::FollowPathSystem>();
-    remove_dead_system_ = std::make_unique<game::system::RemoveDeadSystem>();
+    remove_dead_system_ = std::make_unique<game::system::RemoveDeadSystem>(*entity_factory_);
     block_system_ = std::make_unique<game::system::BlockSystem>();
     set_target_system_ = std::make_unique<game::system::SetTargetSystem>();
     attack_starter_system_ = std::make_unique<game::system::AttackStarterSystem>();
@@ -415,7 +498,7 @@ bool game::scene::GameScene::initSystems()
     animation_state_system_ = std::make_unique<game::system::AnimationStateSystem>(registry_, dispatcher);
     animation_event_system_ = std::make_unique<game::system::AnimationEventSystem>(registry_, dispatcher);
     combat_resolve_system_ = std::make_unique<game::system::CombatResolveSystem>(registry_, dispatcher);
-    projectile_system_ = std::make_unique<game::system::ProjectileSystem>(registry_, dispatcher, *entity_factory_);
+    projectile_system_ = std::make_unique<game::system::ProjectileSystem>(dispatcher, *blueprint_manager_);
     effect_system_ = std::make_unique<game::system::EffectSystem>(registry_, dispatcher, *entity_factory_);
     health_bar_system_ = std::make_unique<game::system::HealthBarSystem>();
     game_rule_system_ = std::make_unique<game::system::GameRuleSystem>(registry_, dispatcher);
@@ -424,6 +507,12 @@ bool game::scene::GameScene::initSystems()
     debug_ui_system_ = std::make_unique<game::system::DebugUISystem>(registry_, context_);
     selection_system_ = std::make_unique<game::system::SelectionSystem>(registry_, context_);
     skill_system_ = std::make_unique<game::system::SkillSystem>(registry_, dispatcher, *entity_factory_);
+
+    // 投射物不是实体，由投射物系统直接绘制（位于主图层+1，即可以遮住角色）
+    render_system_->addLayerPass(engine::component::RenderComponent::MAIN_LAYER + 1,
+                                 [this](engine::render::Renderer &renderer, const engine::render::Camera &camera)
+                                 { projectile_system_->render(renderer, camera); });
+    registry_.ctx().emplace<game::data::ProjectilePool &>(projectile_system_->getPool()); // 供调试UI显示统计
     spdlog::info("Systems initialized");
     return true;
 }
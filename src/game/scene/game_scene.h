@@ -6,6 +6,7 @@
 #include "../data/ui_config.h"
 #include "../data/game_stats.h"
 #include "../data/level_config.h"
+#include "../data/level_snapshot.h"
 #include "../defs/events.h"
 #include <entt/entity/entity.hpp>
 #include "../system/fwd.h"
@@ -17,6 +18,10 @@ namespace engine::ui
 {
     class UIElement;
 }
+namespace engine::loader
+{
+    class LevelPreloader;
+}
 namespace game::spawner
 {
     class EnemySpawner;
@@ -77,6 +82,8 @@ namespace game::scene
         std::shared_ptr<game::data::SessionData> session_data_;              // 会话数据，关卡切换时需要传递的数据
         std::shared_ptr<game::data::UIConfig> ui_config_;                    // UI配置，负责管理UI数据
         std::shared_ptr<game::data::LevelConfig> level_config_;              // 关卡配置，负责管理关卡数据
+        std::shared_ptr<game::data::LevelSnapshot> level_snapshot_;          // 关卡加载后的快照，重开关卡时直接恢复
+        std::shared_ptr<engine::loader::LevelPreloader> level_preloader_;    // 关卡预加载器（由通关结算场景传入），存在时优先使用后台解析的地图数据
         // --- 其他场景数据 ---
         int level_number_{1};
         entt::entity selected_unit_{entt::null}; // 游戏中鼠标选中的单位
@@ -91,12 +98,16 @@ namespace game::scene
          * @param session_data 场景间传递的关卡数据
          * @param ui_config UI配置
          * @param level_config 关卡配置
+         * @param level_snapshot 关卡快照（重开同一关卡时传入，跳过地图加载）
+         * @param level_preloader 关卡预加载器（进入下一关时传入，地图数据已在后台解析）
          */
         GameScene(engine::core::Context &context,
                   std::shared_ptr<game::factory::BlueprintManager> blueprint_manager = nullptr,
                   std::shared_ptr<game::data::SessionData> session_data = nullptr,
                   std::shared_ptr<game::data::UIConfig> ui_config = nullptr,
-                  std::shared_ptr<game::data::LevelConfig> level_config = nullptr);
+                  std::shared_ptr<game::data::LevelConfig> level_config = nullptr,
+                  std::shared_ptr<game::data::LevelSnapshot> level_snapshot = nullptr,
+                  std::shared_ptr<engine::loader::LevelPreloader> level_preloader = nullptr);
         ~GameScene();
 
         void init() override;
@@ -109,6 +120,8 @@ namespace game::scene
         [[nodiscard]] bool initLevelConfig();
         [[nodiscard]] bool initUIConfig();
         [[nodiscard]] bool loadlevel();
+        [[nodiscard]] bool restoreLevelSnapshot(); ///< @brief 从关卡快照恢复地图实体，快照不可用时返回false
+        void captureLevelSnapshot();               ///< @brief 关卡加载完成后捕获快照
         [[nodiscard]] bool initEventConnections();
         [[nodiscard]] bool initInputConnections();
         [[nodiscard]] bool initEntityFactory();
@@ -10,6 +10,7 @@
 #include "../../engine/utils/events.h"
 #include "../../engine/loader/level_loader.h"
 #include "../../engine/loader/basic_entity_builder.h"
+#include "../../engine/loader/level_preloader.h"
 #include "../system/debug_ui_system.h"
 #include <spdlog/spdlog.h>
 #include <entt/entity/registry.hpp>
@@ -51,6 +52,14 @@ namespace game::scene
         registry_.ctx().emplace<std::shared_ptr<game::factory::BlueprintManager>>(blueprint_manager_);
         registry_.ctx().emplace<std::shared_ptr<game::data::UIConfig>>(ui_config_);
         context_.getAudioPlayer().playMusic("win"_hs, 0);
+
+        // 结算界面出现后立即在后台解析下一关地图，点击“下一关”时只需要在主线程创建实体
+        const auto next_level = session_data_->getLevelNumber() + 1;
+        if (next_level <= level_config_->getLevelCount())
+        {
+            level_preloader_ = std::make_shared<engine::loader::LevelPreloader>();
+            level_preloader_->request(level_config_->getMapPath(next_level));
+        }
     }
 
     void LevelClearScene::render()
@@ -68,7 +77,9 @@ namespace game::scene
             blueprint_manager_,
             session_data_,
             ui_config_,
-            level_config_));
+            level_config_,
+            nullptr,
+            level_preloader_));
     }
 
     void LevelClearScene::onBackToTitleClick()
@@ -7,6 +7,11 @@
 #include "../../game/factory/blueprint_manager.h"
 #include "../system/fwd.h"
 
+namespace engine::loader
+{
+    class LevelPreloader;
+}
+
 namespace game::scene
 {
 
@@ -19,6 +24,7 @@ namespace game::scene
         std::shared_ptr<game::data::UIConfig> ui_config_;
         std::shared_ptr<game::data::LevelConfig> level_config_;
         std::shared_ptr<game::data::SessionData> session_data_;
+        std::shared_ptr<engine::loader::LevelPreloader> level_preloader_; ///< @brief 在结算界面显示期间后台预加载下一关，之后交给下一关的GameScene
 
         game::data::GameStats &game_stats_; ///< @brief 构造函数传入关卡内游戏统计数据，需要在此场景中显示
 
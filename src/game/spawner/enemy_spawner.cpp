@@ -6,7 +6,7 @@
 #include "../../engine/utils/math.h"
 #include <entt/entity/registry.hpp>
 #include <entt/signal/dispatcher.hpp>
-#include <spdlog/spdlog.h>
+#include "../../engine/utils/log.h"
 
 namespace game::spawner
 {
@@ -46,7 +46,7 @@ namespace game::spawner
 
                 // 本波次数据处理完毕，弹出关卡波次队列头
                 waves.waves_.pop();
-                spdlog::info("Wave {} start", waves.waves_.size() + 1);
+                MW_LOG_INFO(ENTITY, "Wave {} start", waves.waves_.size() + 1);
             }
         }
 
@@ -77,13 +77,13 @@ namespace game::spawner
         auto level = level_config->getEnemyLevel(level_number);
         auto rarity = level_config->getEnemyRarity(level_number);
 
-        // 弹出敌人类型
-        auto enemy_type = enemy_types_.front();
-        enemy_types_.pop_front();
+        // 弹出敌人类型（队列已打乱，从末尾取出与从头部取出等价）
+        auto enemy_type = enemy_types_.back();
+        enemy_types_.pop_back();
 
         // 创建敌人
         entity_factory_.createEnemyUnit(enemy_type, position, start_index, level, rarity);
-        spdlog::info("spawn enemy: {}, {}", position.x, position.y);
+        MW_LOG_DEBUG(ENTITY, "spawn enemy: {}, {}", position.x, position.y);
     }
 
 }
\ No newline at end of file
@@ -1,7 +1,7 @@
 #pragma once
 #include <entt/entity/fwd.hpp>
 #include <entt/signal/fwd.hpp>
-#include <deque> // 双端队列：两端都可以入队或出队
+#include <vector>
 
 namespace game::factory
 {
@@ -19,9 +19,9 @@ namespace game::spawner
         entt::registry &registry_;
         game::factory::EntityFactory &entity_factory_;
 
-        float spawn_timer_{0.0f};               ///< @brief 波次内生成计时器 (单位：秒)
-        float spawn_interval_{0.0f};            ///< @brief 波次内生成间隔 (单位：秒)
-        std::deque<entt::id_type> enemy_types_; ///< @brief 波次内敌人队列 (使用双端队列是为了支持随机打乱顺序)
+        float spawn_timer_{0.0f};                ///< @brief 波次内生成计时器 (单位：秒)
+        float spawn_interval_{0.0f};             ///< @brief 波次内生成间隔 (单位：秒)
+        std::vector<entt::id_type> enemy_types_; ///< @brief 波次内敌人队列 (已随机打乱，从末尾取出；容量在各波次间复用，不再重复分配)
 
     public:
         /**
@@ -3,6 +3,7 @@
 #include "../component/player_component.h"
 #include "../component/blocked_by_component.h"
 #include "../defs/tags.h"
+#include "../data/dead_queue.h"
 #include <entt/core/hashed_string.hpp>
 #include <entt/entity/registry.hpp>
 #include <entt/signal/dispatcher.hpp>
@@ -73,7 +74,7 @@ namespace game::system
         // 如果是一次性动画实体（例如死亡特效），则标记死亡待移除
         if (registry_.all_of<game::defs::OneShotRemoveTag>(event.entity_))
         {
-            registry_.emplace_or_replace<game::defs::DeadTag>(event.entity_);
+            game::data::markDead(registry_, event.entity_);
             return;
         }
     }
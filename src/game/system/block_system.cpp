@@ -5,11 +5,11 @@
 #include "../defs/tags.h"
 #include "../defs/constants.h"
 #include "../../engine/component/transform_component.h"
-#include "../../engine/component/velocity_component.h"
+#include "movement_groups.h"
 #include "../../engine/utils/events.h"
 #include "../../engine/utils/math.h"
 #include <entt/entity/view.hpp>
-#include <spdlog/spdlog.h>
+#include "../../engine/utils/log.h"
 
 using namespace entt::literals;
 
@@ -18,7 +18,7 @@ namespace game::system
 
     void BlockSystem::update(entt::registry &registry, entt::dispatcher &dispatcher)
     {
-        spdlog::trace("BlockSystem::update");
+        MW_LOG_TRACE(SYSTEM, "BlockSystem::update");
         // --- 检查阻挡者是否依然有效 ---
         auto view_blocked_by = registry.view<game::component::BlockedByComponent>();
         for (auto blocked_by_entity : view_blocked_by)
@@ -27,7 +27,7 @@ namespace game::system
             // 如果BlockedBy指向的实体无效(例如死亡)，移除被阻挡组件，并发送播放动画“walk”事件
             if (!registry.valid(blocked_by_component.entity_))
             {
-                spdlog::info("Blocker: ID: {}, invalid, removing blocker component of ID: {}", entt::to_integral(blocked_by_component.entity_), entt::to_integral(blocked_by_entity));
+                MW_LOG_DEBUG(TARGETING, "Blocker: ID: {}, invalid, removing blocker component of ID: {}", entt::to_integral(blocked_by_component.entity_), entt::to_integral(blocked_by_entity));
                 registry.remove<game::component::BlockedByComponent>(blocked_by_entity);
                 registry.remove<game::defs::ActionLockTag>(blocked_by_entity); // 移除可能存在的动作锁定标签
                 dispatcher.enqueue(engine::utils::PlayAnimationEvent{blocked_by_entity, "walk"_hs, true});
@@ -37,15 +37,9 @@ namespace game::system
         // --- 判断是否需要添加阻挡者组件 ---
         // 获取所有阻挡者
         auto view_blocker = registry.view<game::component::BlockerComponent, engine::component::TransformComponent>();
-        // 获取所有敌人，使用 entt::exclude 排除“包含指定组件的实体”（已经存在阻挡者组件的敌人不需要再添加）
-        auto view_enemy = registry.view<game::component::EnemyComponent,
-                                        engine::component::TransformComponent,
-                                        engine::component::VelocityComponent>(entt::exclude<game::component::BlockedByComponent>);
-        // 遍历所有敌人
-        for (auto enemy_entity : view_enemy)
+        // 遍历尚未被阻挡的敌人（non-owning group，已经存在阻挡者组件的敌人不需要再添加）
+        for (auto [enemy_entity, enemy, enemy_transform, enemy_velocity] : unblockedEnemyGroup(registry).each())
         {
-            const auto &enemy_transform = view_enemy.get<engine::component::TransformComponent>(enemy_entity);
-            auto &enemy_velocity = view_enemy.get<engine::component::VelocityComponent>(enemy_entity);
             // 每个敌人遍历所有阻挡者，检查是否被阻挡
             for (auto blocker_entity : view_blocker)
             {
@@ -64,7 +58,7 @@ namespace game::system
                     enemy_velocity.velocity_ = glm::vec2(0.0f, 0.0f); // 设置敌人速度为0
                     // 给敌人添加被阻挡组件
                     registry.emplace<game::component::BlockedByComponent>(enemy_entity, blocker_entity);
-                    spdlog::info("Enemy: ID: {}, blocked, blocker: ID: {}", entt::to_integral(enemy_entity), entt::to_integral(blocker_entity));
+                    MW_LOG_DEBUG(TARGETING, "Enemy: ID: {}, blocked, blocker: ID: {}", entt::to_integral(enemy_entity), entt::to_integral(blocker_entity));
                 }
             }
         }
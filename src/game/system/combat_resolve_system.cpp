@@ -2,18 +2,17 @@
 #include "../component/stats_component.h"
 #include "../component/player_component.h"
 #include "../component/enemy_component.h"
-#include "../component/blocked_by_component.h"
-#include "../component/blocker_component.h"
 #include "../component/class_name_component.h"
 #include "../data/game_stats.h"
 #include "../../engine/component/transform_component.h"
 #include "../../engine/component/sprite_component.h"
 #include "../defs/tags.h"
+#include "../data/dead_queue.h"
 #include "../defs/events.h"
 #include <entt/entity/registry.hpp>
+#include <algorithm>
 #include <entt/signal/dispatcher.hpp>
-#include <glm/common.hpp>
-#include <spdlog/spdlog.h>
+#include "../../engine/utils/log.h"
 
 using namespace entt::literals;
 
@@ -32,102 +31,122 @@ namespace game::system
         dispatcher_.disconnect(this);
     }
 
+    void CombatResolveSystem::update()
+    {
+        if (pending_.empty())
+            return;
+        // 按目标排序，使同一目标的命中相邻
+        std::sort(pending_.begin(), pending_.end(), [](const PendingHit &lhs, const PendingHit &rhs)
+                  { return lhs.target_ < rhs.target_; });
+        const auto *first = pending_.data();
+        const auto *end = first + pending_.size();
+        while (first != end)
+        {
+            const auto *last = first;
+            while (last != end && last->target_ == first->target_)
+            {
+                ++last;
+            }
+            resolveTarget(first->target_, first, last);
+            first = last;
+        }
+        pending_.clear();
+    }
+
     void CombatResolveSystem::onAttackEvent(const game::defs::AttackEvent &event)
     {
-        if (!registry_.valid(event.target_) || registry_.all_of<game::defs::DeadTag>(event.target_))
+        pending_.push_back({event.target_, event.damage_, false});
+    }
+
+    void CombatResolveSystem::onHealEvent(const game::defs::HealEvent &event)
+    {
+        pending_.push_back({event.target_, event.amount_, true});
+    }
+
+    void CombatResolveSystem::resolveTarget(entt::entity target, const PendingHit *first, const PendingHit *last)
+    {
+        if (!registry_.valid(target) || registry_.all_of<game::defs::DeadTag>(target))
             return;
-        // 根据伤害公式，让目标扣血
-        auto &target_stats = registry_.get<game::component::StatsComponent>(event.target_);
-        float damage = calculateEffectiveDamage(event.damage_, target_stats.def_);
-        target_stats.hp_ -= damage;
+        auto target_stats = registry_.try_get<game::component::StatsComponent>(target);
+        if (!target_stats)
+            return;
+        const bool is_player = registry_.all_of<game::component::PlayerComponent>(target);
+        const bool is_enemy = !is_player && registry_.all_of<game::component::EnemyComponent>(target);
 
-        // 如果目标是玩家
-        if (registry_.all_of<game::component::PlayerComponent>(event.target_))
+        // 累计伤害（根据伤害公式逐次计算）与治疗量（只对玩家有效）
+        float total_damage = 0.0f;
+        float total_heal = 0.0f;
+        int hit_count = 0;
+        int heal_count = 0;
+        for (auto hit = first; hit != last; ++hit)
         {
-            spdlog::info("Player ID: {} took damage from ID: {}, remaining health: {}",
-                         entt::to_integral(event.target_), entt::to_integral(event.attacker_), target_stats.hp_);
-            // 死亡情况
-            if (target_stats.hp_ <= 0)
+            if (!hit->is_heal_)
             {
-                target_stats.hp_ = 0;
-                // 发送移除单位事件
-                dispatcher_.enqueue(game::defs::RemovePlayerUnitEvent{event.target_});
-                spdlog::info("Player ID: {} died", entt::to_integral(event.target_));
-                // NOTE: 可添加死亡特效, 统计信息等
-                // 受伤情况
+                total_damage += calculateEffectiveDamage(hit->amount_, target_stats->def_);
+                ++hit_count;
             }
-            else if (target_stats.hp_ < target_stats.max_hp_)
+            else if (is_player)
             {
-                registry_.emplace_or_replace<game::defs::InjuredTag>(event.target_);
+                total_heal += hit->amount_;
+                ++heal_count;
             }
-            return;
         }
+        if (hit_count == 0 && heal_count == 0)
+            return;
+
+        target_stats->hp_ = std::min(target_stats->hp_ - total_damage + total_heal, target_stats->max_hp_);
+        MW_LOG_DEBUG(COMBAT, "ID: {} took {} hits (damage: {}), {} heals (amount: {}), remaining health: {}",
+                     entt::to_integral(target), hit_count, total_damage, heal_count, total_heal, target_stats->hp_);
 
-        // 如果目标是敌人
-        if (registry_.all_of<game::component::EnemyComponent>(event.target_))
+        // --- 存活情况：更新受伤状态 ---
+        if (target_stats->hp_ > 0)
         {
-            spdlog::info("Enemy ID: {} took damage from ID: {}, remaining health: {}",
-                         entt::to_integral(event.target_), entt::to_integral(event.attacker_), target_stats.hp_);
-            // 死亡情况
-            if (target_stats.hp_ <= 0)
+            if (target_stats->hp_ < target_stats->max_hp_)
             {
-                target_stats.hp_ = 0;
-                registry_.emplace_or_replace<game::defs::DeadTag>(event.target_);
-                spdlog::info("Enemy ID: {} died", entt::to_integral(event.target_));
-                // 发送死亡特效事件，需要先获取class_id、位置和是否翻转
-                const auto [class_name, transform, sprite] = registry_.get<game::component::ClassNameComponent,
-                                                                           engine::component::TransformComponent,
-                                                                           engine::component::SpriteComponent>(event.target_);
-                dispatcher_.enqueue(game::defs::EnemyDeadEffectEvent{class_name.class_id_, transform.position_, sprite.sprite_.is_flipped_});
-                // 更新统计信息
-                auto &game_stats = registry_.ctx().get<game::data::GameStats &>();
-                game_stats.enemy_killed_count_++; // 敌人击杀数量+1
-                if ((game_stats.enemy_killed_count_ + game_stats.enemy_arrived_count_) >= game_stats.enemy_count_)
-                {
-                    spdlog::warn("enemy cleared");
-                    // 通关成功
-                    dispatcher_.enqueue(game::defs::LevelClearDelayedEvent{});
-                }
-                // 如果敌人被阻挡，减少阻挡者的阻挡计数
-                if (auto blocked_by = registry_.try_get<game::component::BlockedByComponent>(event.target_); blocked_by)
-                {
-                    auto blocker_entity = blocked_by->entity_;
-                    if (registry_.valid(blocker_entity))
-                    {
-                        auto &blocker = registry_.get<game::component::BlockerComponent>(blocker_entity);
-                        blocker.current_count_ = glm::max(0, blocker.current_count_ - 1);
-                    }
-                }
-                // 受伤情况
+                registry_.emplace_or_replace<game::defs::InjuredTag>(target);
             }
-            else if (target_stats.hp_ < target_stats.max_hp_)
+            else
             {
-                registry_.emplace_or_replace<game::defs::InjuredTag>(event.target_);
+                registry_.remove<game::defs::InjuredTag>(target);
+            }
+            // 添加治疗特效
+            if (heal_count > 0)
+            {
+                const auto &transform = registry_.get<engine::component::TransformComponent>(target);
+                dispatcher_.enqueue(game::defs::EffectEvent{"heal"_hs, transform.position_, false});
             }
             return;
         }
-    }
 
-    void CombatResolveSystem::onHealEvent(const game::defs::HealEvent &event)
-    {
-        if (!registry_.valid(event.target_))
-            return;
-        if (!registry_.all_of<game::component::PlayerComponent>(event.target_))
-            return;
-        // 根据治疗量，让目标回血
-        auto &target_stats = registry_.get<game::component::StatsComponent>(event.target_);
-        target_stats.hp_ += event.amount_;
-        spdlog::info("Player ID: {} healed by healer ID: {}, remaining health: {}",
-                     entt::to_integral(event.healer_), entt::to_integral(event.target_), event.amount_);
-        // 如果治疗后满血，移除受伤标签
-        if (target_stats.hp_ >= target_stats.max_hp_)
+        // --- 死亡情况 ---
+        target_stats->hp_ = 0;
+        if (is_player)
         {
-            target_stats.hp_ = target_stats.max_hp_;
-            registry_.remove<game::defs::InjuredTag>(event.target_);
+            // 发送移除单位事件
+            dispatcher_.enqueue(game::defs::RemovePlayerUnitEvent{target});
+            MW_LOG_INFO(COMBAT, "Player ID: {} died", entt::to_integral(target));
+            // NOTE: 可添加死亡特效, 统计信息等
+        }
+        else if (is_enemy)
+        {
+            game::data::markDead(registry_, target);
+            MW_LOG_INFO(COMBAT, "Enemy ID: {} died", entt::to_integral(target));
+            // 发送死亡特效事件，需要先获取class_id、位置和是否翻转
+            const auto [class_name, transform, sprite] = registry_.get<game::component::ClassNameComponent,
+                                                                       engine::component::TransformComponent,
+                                                                       engine::component::SpriteComponent>(target);
+            dispatcher_.enqueue(game::defs::EnemyDeadEffectEvent{class_name.class_id_, transform.position_, sprite.sprite_.is_flipped_});
+            // 更新统计信息
+            auto &game_stats = registry_.ctx().get<game::data::GameStats &>();
+            game_stats.enemy_killed_count_++; // 敌人击杀数量+1
+            if ((game_stats.enemy_killed_count_ + game_stats.enemy_arrived_count_) >= game_stats.enemy_count_)
+            {
+                MW_LOG_WARN(COMBAT, "enemy cleared");
+                // 通关成功
+                dispatcher_.enqueue(game::defs::LevelClearDelayedEvent{});
+            }
+            // 阻挡者的阻挡计数由RemoveDeadSystem在销毁时统一释放
         }
-        // 添加治疗特效
-        const auto &transform = registry_.get<engine::component::TransformComponent>(event.target_);
-        dispatcher_.enqueue(game::defs::EffectEvent{"heal"_hs, transform.position_, false});
     }
 
     // --- 辅助函数 ---
@@ -2,6 +2,7 @@
 #include <entt/entity/fwd.hpp>
 #include <entt/signal/fwd.hpp>
 #include "../defs/events.h"
+#include <vector>
 
 namespace game::system
 {
@@ -9,22 +10,39 @@ namespace game::system
     /**
      * @brief 战斗结算系统，用于处理战斗结算
      *
-     * 根据接受到的事件（攻击/治疗），执行相应的结算操作。
+     * 接受到的事件（攻击/治疗）先缓存起来，在update中按目标批量结算：
+     * 同一目标本帧的所有命中只读取一次组件、计算一次最终血量，死亡/受伤状态也只改变一次，
+     * 因此结算结果与事件的先后顺序无关。
      */
     class CombatResolveSystem
     {
+        /// @brief 待结算的命中（攻击或治疗）
+        struct PendingHit
+        {
+            entt::entity target_; ///< @brief 目标
+            float amount_;        ///< @brief 原始伤害或治疗量
+            bool is_heal_;        ///< @brief 是否为治疗
+        };
+
         entt::registry &registry_;
         entt::dispatcher &dispatcher_;
+        std::vector<PendingHit> pending_; ///< @brief 本帧收到的命中（结算后清空，保留容量）
 
     public:
         CombatResolveSystem(entt::registry &registry, entt::dispatcher &dispatcher);
         ~CombatResolveSystem();
 
+        /// @brief 批量结算上一次事件分发收到的所有命中
+        void update();
+
     private:
-        // 事件回调函数
+        // 事件回调函数（只记录命中）
         void onAttackEvent(const game::defs::AttackEvent &event);
         void onHealEvent(const game::defs::HealEvent &event);
 
+        /// @brief 结算同一目标的所有命中 [first, last)
+        void resolveTarget(entt::entity target, const PendingHit *first, const PendingHit *last);
+
         /**
          * @brief 计算最终伤害（公式可修改）
          * 当前计算公式：攻击力 - 防御力，最小伤害为攻击力的10%
@@ -19,14 +19,22 @@
 #include <entt/entity/registry.hpp>
 #include <entt/core/hashed_string.hpp>
 #include <entt/signal/dispatcher.hpp>
+#include <algorithm>
 #include "../component/skill_component.h"
 #include "../defs/tags.h"
 #include "../defs/events.h"
 #include "../data/game_stats.h"
+#include "../data/dead_queue.h"
 #include "../data/level_data.h"
 #include "../data/session_data.h"
 #include "../factory/blueprint_manager.h"
+#include "../factory/entity_pool.h"
+#include "../data/projectile_pool.h"
+#include "../../engine/utils/log.h"
 #include "../../engine/audio/audio_player.h"
+#include "../../engine/utils/dispatcher_profiler.h"
+#include "../../engine/utils/frame_arena.h"
+#include "../../engine/utils/alloc_tracker.h"
 #include "../../engine/core/time.h"
 #include "../../engine/utils/math.h"
 using namespace entt::literals;
@@ -264,6 +272,8 @@ namespace game::system
         // 技能显示与交互
         if (auto skill = registry_.try_get<game::component::SkillComponent>(entity); skill)
         {
+            // 计时器只保存开始时间，剩余时间与冷却进度根据当前游戏时间计算
+            const auto game_time = registry_.ctx().get<game::data::GameStats &>().game_time_;
             // 如果技能准备就绪，则按钮可用（激活技能），否则按钮不可用
             auto ready = registry_.all_of<game::defs::SkillReadyTag>(entity);
             ImGui::BeginDisabled(!ready);
@@ -285,7 +295,7 @@ namespace game::system
                 }
                 else
                 {
-                    ImGui::Text("激活中，剩余时间: %.1f 秒", skill->duration_ - skill->duration_timer_);
+                    ImGui::Text("激活中，剩余时间: %.1f 秒", skill->duration_ - (game_time - skill->duration_start_time_));
                 }
                 // 否则显示冷却时间
             }
@@ -300,7 +310,7 @@ namespace game::system
                 else
                 {
                     // 用进度条显示冷却时间百分比
-                    ImGui::ProgressBar(skill->cooldown_timer_ / skill->cooldown_);
+                    ImGui::ProgressBar((game_time - skill->cooldown_start_time_) / skill->cooldown_);
                 }
             }
             // 显示技能描述
@@ -436,6 +446,216 @@ namespace game::system
         {
             context_.getDispatcher().enqueue<game::defs::LevelClearEvent>();
         }
+        // 实体清理统计
+        if (registry_.ctx().contains<game::data::DeadQueue>())
+        {
+            const auto &dead_stats = registry_.ctx().get<game::data::DeadQueue>().getStats();
+            ImGui::Separator();
+            ImGui::Text("本帧销毁: %zu  回收: %zu", dead_stats.destroyed_, dead_stats.recycled_);
+            ImGui::Text("累计销毁: %zu  回收: %zu", dead_stats.total_destroyed_, dead_stats.total_recycled_);
+        }
+        // 对象池统计（命中率越高，战斗中新建实体越少）
+        if (registry_.ctx().contains<game::factory::EntityPool &>())
+        {
+            auto &entity_pool = registry_.ctx().get<game::factory::EntityPool &>();
+            ImGui::Separator();
+            if (ImGui::BeginTable("对象池", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_SizingFixedFit))
+            {
+                ImGui::TableSetupColumn("对象池");
+                ImGui::TableSetupColumn("命中");
+                ImGui::TableSetupColumn("未命中");
+                ImGui::TableSetupColumn("命中率");
+                ImGui::TableSetupColumn("闲置");
+                ImGui::TableHeadersRow();
+                for (size_t i = 0; i < static_cast<size_t>(game::component::PoolType::COUNT); ++i)
+                {
+                    auto type = static_cast<game::component::PoolType>(i);
+                    const auto &stats = entity_pool.getStats(type);
+                    auto total = stats.hits_ + stats.misses_;
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%s", game::factory::EntityPool::getTypeName(type));
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%zu", stats.hits_);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%zu", stats.misses_);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.1f%%", total > 0 ? 100.0f * stats.hits_ / total : 0.0f);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%zu", stats.available_);
+                }
+                ImGui::EndTable();
+            }
+            if (ImGui::Button("重置对象池统计"))
+            {
+                entity_pool.resetStats();
+            }
+        }
+        // 投射物池统计
+        if (registry_.ctx().contains<game::data::ProjectilePool &>())
+        {
+            const auto &projectile_pool = registry_.ctx().get<game::data::ProjectilePool &>();
+            ImGui::Separator();
+            ImGui::Text("飞行中投射物: %zu  峰值: %zu", projectile_pool.size(), projectile_pool.getPeakSize());
+        }
+        // 音效声部统计
+        {
+            auto &audio_player = context_.getAudioPlayer();
+            const auto &voice_stats = audio_player.getVoiceStats();
+            ImGui::Separator();
+            ImGui::Text("音效声部: %zu/%zu  播放: %zu  抢占: %zu  放弃: %zu",
+                        audio_player.getActiveVoiceCount(), audio_player.getVoiceCount(),
+                        voice_stats.played_, voice_stats.stolen_, voice_stats.dropped_);
+            if (ImGui::Button("重置音效统计"))
+            {
+                audio_player.resetVoiceStats();
+            }
+        }
+        // 帧内存统计（缓冲区用尽时退回堆上分配，次数持续增加时应增大 frame_arena_kb）
+        {
+            auto &frame_arena = context_.getFrameArena();
+            const auto &arena_stats = frame_arena.getStats();
+            ImGui::Separator();
+            ImGui::Text("帧内存: %zu B  峰值: %zu B / %zu B", arena_stats.bytes_, arena_stats.peak_bytes_, frame_arena.getCapacity());
+            if (arena_stats.total_fallbacks_ > 0)
+                ImGui::TextColored(ImVec4(1.0f, 0.6f, 0.2f, 1.0f), "退回堆分配: %zu (累计 %zu)", arena_stats.fallbacks_, arena_stats.total_fallbacks_);
+            else
+                ImGui::Text("退回堆分配: 0");
+            if (ImGui::Button("重置帧内存统计"))
+            {
+                frame_arena.resetStats();
+            }
+        }
+        // 堆分配统计（按系统，需以 MW_TRACK_ALLOCATIONS 编译）
+        ImGui::Separator();
+        if (ImGui::TreeNode("堆分配"))
+        {
+            using engine::utils::AllocTracker;
+            if (!AllocTracker::ENABLED)
+            {
+                ImGui::TextDisabled("未开启（CMake 选项 MW_TRACK_ALLOCATIONS）");
+            }
+            else
+            {
+                ImGui::Text("本帧分配: %zu 次  %zu B", AllocTracker::getFrameCount(), AllocTracker::getFrameBytes());
+                if (ImGui::BeginTable("alloc_stats", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+                {
+                    ImGui::TableSetupColumn("作用域");
+                    ImGui::TableSetupColumn("次数");
+                    ImGui::TableSetupColumn("字节");
+                    ImGui::TableSetupColumn("峰值次数");
+                    ImGui::TableSetupColumn("累计次数");
+                    ImGui::TableHeadersRow();
+                    for (size_t i = 0; i < AllocTracker::getScopeCount(); ++i)
+                    {
+                        const auto &stats = AllocTracker::getScopeStats(i);
+                        ImGui::TableNextRow();
+                        ImGui::TableNextColumn();
+                        ImGui::Text("%s", stats.name_);
+                        ImGui::TableNextColumn();
+                        // 每帧都在分配的系统高亮显示
+                        if (stats.count_ > 0)
+                            ImGui::TextColored(ImVec4(1.0f, 0.6f, 0.2f, 1.0f), "%zu", stats.count_);
+                        else
+                            ImGui::Text("0");
+                        ImGui::TableNextColumn();
+                        ImGui::Text("%zu", stats.bytes_);
+                        ImGui::TableNextColumn();
+                        ImGui::Text("%zu", stats.peak_count_);
+                        ImGui::TableNextColumn();
+                        ImGui::Text("%zu", stats.total_count_);
+                    }
+                    ImGui::EndTable();
+                }
+                if (ImGui::Button("重置堆分配统计"))
+                {
+                    AllocTracker::resetStats();
+                }
+            }
+            ImGui::TreePop();
+        }
+        // 事件分发统计（上一帧的数量、队列长度与处理耗时，以及峰值）
+        ImGui::Separator();
+        if (ImGui::TreeNode("事件分发"))
+        {
+            auto &profiler = context_.getDispatcherProfiler();
+            ImGui::Text("分发耗时: %.3f ms  统计帧数: %zu", profiler.getFrameMs(), profiler.getFrames());
+            if (ImGui::BeginTable("dispatcher_stats", 7, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+            {
+                ImGui::TableSetupColumn("事件");
+                ImGui::TableSetupColumn("数量");
+                ImGui::TableSetupColumn("队列");
+                ImGui::TableSetupColumn("耗时(ms)");
+                ImGui::TableSetupColumn("峰值数量");
+                ImGui::TableSetupColumn("峰值队列");
+                ImGui::TableSetupColumn("峰值耗时(ms)");
+                ImGui::TableHeadersRow();
+                profiler.forEach([](const engine::utils::EventStats &stats)
+                                 {
+                    if (stats.total_ == 0)
+                        return;
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn();
+                    // 单帧数量过多（事件风暴）时高亮显示
+                    if (stats.count_ >= engine::utils::DispatcherProfiler::STORM_THRESHOLD)
+                        ImGui::TextColored(ImVec4(1.0f, 0.3f, 0.3f, 1.0f), "%s", stats.name_.c_str());
+                    else
+                        ImGui::Text("%s", stats.name_.c_str());
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%zu", stats.count_);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%zu", stats.queued_);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.3f", stats.handler_ms_);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%zu", stats.peak_count_);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%zu", stats.peak_queued_);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.3f", stats.peak_handler_ms_); });
+                ImGui::EndTable();
+            }
+            // 分发阶段：上一帧处理/推迟的事件数量，预算可实时调整
+            profiler.forEachPhase([&profiler](entt::id_type phase_id, const engine::utils::PhaseStats &stats)
+                                  {
+                int budget = static_cast<int>(stats.budget_);
+                ImGui::Text("阶段[%s] 处理: %zu  推迟: %zu", stats.name_.c_str(), stats.processed_, stats.deferred_);
+                ImGui::SameLine();
+                ImGui::PushID(static_cast<int>(phase_id));
+                ImGui::SetNextItemWidth(120.0f);
+                if (ImGui::InputInt("预算", &budget, 16, 128))
+                {
+                    profiler.setPhaseBudget(phase_id, static_cast<size_t>(std::max(budget, 0)));
+                }
+                ImGui::PopID(); });
+            if (ImGui::Button("重置事件统计"))
+            {
+                profiler.resetStats();
+            }
+            ImGui::SameLine();
+            if (ImGui::Button("导出CSV"))
+            {
+                profiler.exportCsv("dispatcher_stats.csv");
+            }
+            ImGui::TreePop();
+        }
+        // 日志级别（按分类调整）
+        ImGui::Separator();
+        if (ImGui::TreeNode("日志级别"))
+        {
+            static constexpr const char *LEVEL_NAMES[] = {"trace", "debug", "info", "warn", "error", "critical", "off"};
+            for (size_t i = 0; i < static_cast<size_t>(engine::utils::LogCategory::COUNT); ++i)
+            {
+                auto category = static_cast<engine::utils::LogCategory>(i);
+                int level = static_cast<int>(engine::utils::Log::getLevel(category));
+                if (ImGui::Combo(engine::utils::Log::getCategoryName(category), &level, LEVEL_NAMES, IM_ARRAYSIZE(LEVEL_NAMES)))
+                {
+                    engine::utils::Log::setLevel(category, static_cast<spdlog::level::level_enum>(level));
+                }
+            }
+            ImGui::Text("丢弃的日志: %zu", engine::utils::Log::getDroppedCount());
+            ImGui::TreePop();
+        }
         // TODO: 未来可按需添加其他调试工具
         ImGui::End();
     }
@@ -1,28 +1,20 @@
 #include "followpath_system.h"
 #include "../data/waypoint_node.h"
-#include "../component/enemy_component.h"
-#include "../../engine/component/velocity_component.h"
-#include "../../engine/component/transform_component.h"
-#include "../component/blocked_by_component.h"
+#include "movement_groups.h"
 #include "../defs/events.h"
 #include "../defs/tags.h"
+#include "../data/dead_queue.h"
 #include "../../engine/utils/math.h"
 #include <entt/signal/dispatcher.hpp>
 #include <entt/entity/registry.hpp>
 #include <glm/geometric.hpp>
-#include <spdlog/spdlog.h>
+#include "../../engine/utils/log.h"
 void game::system::FollowPathSystem::update(entt::registry &registry, entt::dispatcher &dispatcher, std::unordered_map<int, data::WaypointNode> &waypoint_nodes)
 {
-    spdlog::trace("FollowPathSystem::update");
-    // 筛选依据：速度组件、变换组件、敌人组件
-    auto view = registry.view<engine::component::VelocityComponent,
-                              engine::component::TransformComponent,
-                              game::component::EnemyComponent>(entt::exclude<game::component::BlockedByComponent, game::defs::ActionLockTag>);
-    for (auto entity : view)
+    MW_LOG_TRACE(SYSTEM, "FollowPathSystem::update");
+    // 遍历未被阻挡、未锁定动作的敌人（non-owning group，筛选条件由 group 增量维护）
+    for (auto [entity, velocity, transform, enemy] : walkingEnemyGroup(registry).each())
     {
-        auto &velocity = view.get<engine::component::VelocityComponent>(entity);
-        auto &transform = view.get<engine::component::TransformComponent>(entity);
-        auto &enemy = view.get<game::component::EnemyComponent>(entity);
 
         // 获取目标节点
         auto target_node = waypoint_nodes.at(enemy.target_waypoint_id_);
@@ -37,10 +29,10 @@ void game::system::FollowPathSystem::update(entt::registry &registry, entt::disp
             auto size = target_node.next_node_ids_.size();
             if (size == 0)
             {
-                spdlog::info("Enemy arrive home");
+                MW_LOG_INFO(ENTITY, "Enemy arrive home");
                 // 发送信号并添加删除标记
                 dispatcher.enqueue<game::defs::EnemyArriveHomeEvent>(); // 具体做什么，由回调函数决定
-                registry.emplace<game::defs::DeadTag>(entity);          // 用于延迟删除
+                game::data::markDead(registry, entity);                 // 用于延迟删除
                 continue;
             }
             // 随机选择下一个节点
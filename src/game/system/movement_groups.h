@@ -0,0 +1,53 @@
+#pragma once
+#include "../component/enemy_component.h"
+#include "../component/blocked_by_component.h"
+#include "../defs/tags.h"
+#include "../../engine/component/velocity_component.h"
+#include "../../engine/component/transform_component.h"
+#include "../../engine/component/sprite_component.h"
+#include "../../engine/system/movement_system.h"
+#include <entt/entity/registry.hpp>
+
+namespace game::system
+{
+    // --- 敌人移动相关系统使用的 non-owning group ---
+    // 速度与变换组件的存储由 MovementSystem 的 owning group 拥有，non-owning group 不改变组件的排列，
+    // 只维护一份满足条件（包含/排除）的实体列表，在组件增删时增量更新，因此可以与 owning group 共存。
+    // 遍历时不需要再逐个实体检查 Enemy/BlockedBy/ActionLock 等组件。
+
+    /// @brief 可以行走的敌人（未被阻挡、未锁定动作），FollowPathSystem 使用
+    inline auto walkingEnemyGroup(entt::registry &registry)
+    {
+        return registry.group(entt::get<engine::component::VelocityComponent,
+                                        engine::component::TransformComponent,
+                                        game::component::EnemyComponent>,
+                              entt::exclude<game::component::BlockedByComponent, game::defs::ActionLockTag>);
+    }
+
+    /// @brief 需要面朝移动方向的敌人（未被阻挡、未锁定动作），OrientationSystem 使用
+    inline auto facingEnemyGroup(entt::registry &registry)
+    {
+        return registry.group(entt::get<engine::component::VelocityComponent,
+                                        game::component::EnemyComponent,
+                                        engine::component::SpriteComponent>,
+                              entt::exclude<game::component::BlockedByComponent, game::defs::ActionLockTag>);
+    }
+
+    /// @brief 尚未被阻挡的敌人，BlockSystem 使用
+    inline auto unblockedEnemyGroup(entt::registry &registry)
+    {
+        return registry.group(entt::get<game::component::EnemyComponent,
+                                        engine::component::TransformComponent,
+                                        engine::component::VelocityComponent>,
+                              entt::exclude<game::component::BlockedByComponent>);
+    }
+
+    /// @brief 声明移动相关的所有 group（场景初始化时调用一次，之后各系统取用的都是已维护好的 group）
+    inline void declareMovementGroups(entt::registry &registry)
+    {
+        engine::system::MovementSystem::group(registry);
+        walkingEnemyGroup(registry);
+        facingEnemyGroup(registry);
+        unblockedEnemyGroup(registry);
+    }
+}
@@ -3,7 +3,7 @@
 #include "../component/target_component.h"
 #include "../component/blocked_by_component.h"
 #include "../defs/tags.h"
-#include "../../engine/component/velocity_component.h"
+#include "movement_groups.h"
 #include "../../engine/component/sprite_component.h"
 #include "../../engine/component/transform_component.h"
 #include <entt/entity/registry.hpp>
@@ -70,14 +70,9 @@ namespace game::system
 
     void OrientationSystem::updateMoving(entt::registry &registry)
     {
-        // 移动中的敌人角色，面朝移动方向
-        auto view_moving = registry.view<engine::component::VelocityComponent,
-                                         game::component::EnemyComponent,
-                                         engine::component::SpriteComponent>(entt::exclude<game::component::BlockedByComponent, game::defs::ActionLockTag>);
-        for (auto entity : view_moving)
+        // 移动中的敌人角色，面朝移动方向（non-owning group，已排除被阻挡、锁定动作的敌人）
+        for (auto [entity, velocity, enemy, sprite] : facingEnemyGroup(registry).each())
         {
-            const auto &velocity = view_moving.get<engine::component::VelocityComponent>(entity);
-            auto &sprite = view_moving.get<engine::component::SpriteComponent>(entity);
             // 根据速度的 x 分量符号判断朝向
             bool face_right = velocity.velocity_.x > 0.0f;
             if (registry.all_of<game::defs::FaceLeftTag>(entity))
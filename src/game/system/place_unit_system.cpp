@@ -3,6 +3,7 @@
 #include "../data/game_stats.h"
 #include "../defs/events.h"
 #include "../defs/tags.h"
+#include "../data/dead_queue.h"
 #include "../component/place_occupied_component.h"
 #include "../factory/entity_factory.h"
 #include "../component/unit_prep_component.h"
@@ -135,20 +136,8 @@ namespace game::system
 
     void PlaceUnitSystem::onRemoveUnitEvent(const game::defs::RemovePlayerUnitEvent &event)
     {
-        // 标记该单位为死亡
-        registry_.emplace_or_replace<game::defs::DeadTag>(event.entity_);
-        // 检查所有被占用的地点，如果占用者是移除事件中的单位，则移除占用组件
-        auto view = registry_.view<game::component::PlaceOccupiedComponent>();
-        for (auto entity : view)
-        {
-            auto &place_occupied = view.get<game::component::PlaceOccupiedComponent>(entity);
-            if (place_occupied.entity_ == event.entity_)
-            {
-                registry_.remove<game::component::PlaceOccupiedComponent>(entity);
-                spdlog::info("移除地点 {} 的占用组件", entt::to_integral(entity));
-                break;
-            }
-        }
+        // 标记该单位为死亡（放置点占用与技能标识由RemoveDeadSystem在销毁时统一释放）
+        game::data::markDead(registry_, event.entity_);
     }
 
     bool PlaceUnitSystem::onPlaceUnit()
@@ -178,7 +167,7 @@ namespace game::system
             // 扣除费用
             game_stats.cost_ -= unit_prep_component.cost_;
             // 移除单位准备类型实体
-            registry_.emplace_or_replace<game::defs::DeadTag>(entity);
+            game::data::markDead(registry_, entity);
 
             // 通知UI移除对应肖像
             context_.getDispatcher().enqueue(game::defs::RemoveUIPortraitEvent{unit_data.name_id_});
@@ -210,7 +199,7 @@ namespace game::system
         auto view = registry_.view<game::component::UnitPrepComponent>();
         for (auto entity : view)
         {
-            registry_.emplace_or_replace<game::defs::DeadTag>(entity);
+            game::data::markDead(registry_, entity);
             spdlog::info("RemoveUnitPrepSystem::update clean entity: {}", entt::to_integral(entity));
         }
         return false; // 让鼠标右键可以穿透
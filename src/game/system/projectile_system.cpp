@@ -1,24 +1,19 @@
 #include "projectile_system.h"
-#include "../component/projectile_component.h"
-#include "../defs/tags.h"
-#include "../defs/events.h"
-#include "../factory/entity_factory.h"
-#include "../../engine/component/transform_component.h"
+#include "../factory/blueprint_manager.h"
+#include "../../engine/render/render.h"
+#include "../../engine/render/camera.h"
 #include "../../engine/utils/events.h"
-#include <entt/entity/registry.hpp>
+#include <entt/core/hashed_string.hpp>
 #include <entt/signal/dispatcher.hpp>
-#include <glm/gtc/constants.hpp>
-#include <glm/common.hpp>
-#include <glm/trigonometric.hpp>
-#include <spdlog/spdlog.h>
+#include "../../engine/utils/log.h"
 
 using namespace entt::literals;
 
 namespace game::system
 {
 
-    ProjectileSystem::ProjectileSystem(entt::registry &registry, entt::dispatcher &dispatcher, game::factory::EntityFactory &entity_factory)
-        : registry_(registry), dispatcher_(dispatcher), entity_factory_(entity_factory)
+    ProjectileSystem::ProjectileSystem(entt::dispatcher &dispatcher, game::factory::BlueprintManager &blueprint_manager)
+        : dispatcher_(dispatcher), blueprint_manager_(blueprint_manager)
     {
         dispatcher_.sink<game::defs::EmitProjectileEvent>().connect<&ProjectileSystem::onEmitProjectileEvent>(this);
     }
@@ -30,54 +25,61 @@ namespace game::system
 
     void ProjectileSystem::update(float delta_time)
     {
-        // 获取所有投射物
-        auto view = registry_.view<game::component::ProjectileComponent, engine::component::TransformComponent>();
-        for (auto entity : view)
+        // 批量更新所有投射物，到达终点的投射物命中目标（发送攻击事件以及播放音效）
+        for (const auto &arrival : pool_.update(delta_time))
         {
-            auto &projectile = registry_.get<game::component::ProjectileComponent>(entity);
-            auto &transform = registry_.get<engine::component::TransformComponent>(entity);
-            // 更新飞行时间
-            projectile.current_flight_time_ += delta_time;
-            // 如果飞行时间超过总飞行时间，则命中目标（发送攻击事件以及播放音效）并销毁
-            if (projectile.current_flight_time_ >= projectile.total_flight_time_)
-            {
-                dispatcher_.enqueue(game::defs::AttackEvent{entity, projectile.target_, projectile.damage_});
-                dispatcher_.enqueue(engine::utils::PlaySoundEvent{entity, "hit"_hs});
-                registry_.emplace<game::defs::DeadTag>(entity);
-                continue;
-            }
-            // 计算飞行进度 (t 从 0 到 1)
-            float t = projectile.current_flight_time_ / projectile.total_flight_time_;
-            t = glm::clamp(t, 0.0f, 1.0f); // 确保 t 在 [0, 1] 区间
-
-            // 1. 计算水平位置 (线性插值)
-            glm::vec2 horizontal_pos = glm::mix(projectile.start_position_, projectile.target_position_, t);
-
-            // 2. 计算垂直方向的弧线偏移
-            // 使用 sin 函数可以轻松创建弧线: sin(0)=0, sin(PI/2)=1, sin(PI)=0
-            float arc_offset = glm::sin(t * glm::pi<float>()) * projectile.arc_height_;
-
-            // 3. 合成最终位置
-            transform.position_ = horizontal_pos;
-            transform.position_.y -= arc_offset; // Y轴向下为正，所以减去偏移使其向上拱起
+            dispatcher_.enqueue(game::defs::AttackEvent{entt::null, arrival.target_, arrival.damage_});
+            dispatcher_.enqueue(engine::utils::PlaySoundEvent{entt::null, visuals_[arrival.visual_].hit_sound_id_, arrival.position_});
+        }
+    }
 
-            // 4. 根据上一帧的位置计算朝向，并更新TransformComponent的旋转参数
-            auto direction = transform.position_ - projectile.previous_position_;
-            transform.rotation_ = glm::atan(direction.y, direction.x) * 180.0f / glm::pi<float>();
+    void ProjectileSystem::render(engine::render::Renderer &renderer, const engine::render::Camera &camera) const
+    {
+        for (size_t i = 0; i < pool_.size(); ++i)
+        {
+            const auto &visual = visuals_[pool_.getVisual(i)];
+            renderer.drawSprite(camera, visual.sprite_, pool_.getPosition(i) + visual.offset_, visual.size_, pool_.getRotation(i));
+        }
+    }
 
-            // 5. 更新上一帧的位置
-            projectile.previous_position_ = transform.position_;
+    uint16_t ProjectileSystem::getVisualIndex(entt::id_type id)
+    {
+        if (auto it = visual_indices_.find(id); it != visual_indices_.end())
+        {
+            return it->second;
+        }
+        const auto &blueprint = blueprint_manager_.getProjectileBlueprint(id);
+        ProjectileVisual visual{engine::component::Sprite(blueprint.sprite_.path_, blueprint.sprite_.src_rect_),
+                                blueprint.sprite_.size_,
+                                blueprint.sprite_.offset_,
+                                "hit"_hs};
+        // 尺寸为0时使用源矩形大小（与SpriteComponent一致）
+        if (visual.size_ == glm::vec2(0.0f))
+        {
+            visual.size_ = blueprint.sprite_.src_rect_.size;
+        }
+        // 命中音效优先使用蓝图中的音效，否则播放全局“hit”音效
+        if (auto sound = blueprint.sounds_.sounds_.find("hit"_hs); sound != blueprint.sounds_.sounds_.end())
+        {
+            visual.hit_sound_id_ = sound->second;
         }
+        auto index = static_cast<uint16_t>(visuals_.size());
+        visuals_.push_back(std::move(visual));
+        visual_indices_.emplace(id, index);
+        return index;
     }
 
     void ProjectileSystem::onEmitProjectileEvent(const game::defs::EmitProjectileEvent &event)
     {
-        spdlog::info("Emit projectile: {}", event.id_);
-        entity_factory_.createProjectile(event.id_,
-                                         event.start_position_,
-                                         event.target_position_,
-                                         event.target_,
-                                         event.damage_);
+        MW_LOG_DEBUG(COMBAT, "Emit projectile: {}", event.id_);
+        const auto &blueprint = blueprint_manager_.getProjectileBlueprint(event.id_);
+        pool_.spawn(getVisualIndex(event.id_),
+                    event.start_position_,
+                    event.target_position_,
+                    event.target_,
+                    event.damage_,
+                    blueprint.arc_height_,
+                    blueprint.total_flight_time_);
     }
 
-}
\ No newline at end of file
+}
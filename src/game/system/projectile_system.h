@@ -1,11 +1,21 @@
 #pragma once
 #include "../defs/events.h"
+#include "../data/projectile_pool.h"
+#include "../../engine/component/sprite_component.h"
 #include <entt/entity/fwd.hpp>
 #include <entt/signal/fwd.hpp>
+#include <unordered_map>
+#include <vector>
+
+namespace engine::render
+{
+    class Renderer;
+    class Camera;
+}
 
 namespace game::factory
 {
-    class EntityFactory;
+    class BlueprintManager;
 }
 
 namespace game::system
@@ -13,24 +23,45 @@ namespace game::system
 
     /**
      * @brief 投射物系统
-     * 1. 相响应投射物创建事件，创建投射物实体
-     * 2. 更新投射物的飞行状态，并发送攻击事件和播放音效
+     * 1. 相响应投射物创建事件，将投射物加入投射物池（不创建实体）
+     * 2. 批量更新投射物的飞行状态，并发送攻击事件和播放音效
+     * 3. 直接绘制所有飞行中的投射物（由RenderSystem在对应图层调用）
      */
     class ProjectileSystem
     {
-        entt::registry &registry_;
+        /// @brief 投射物外观（同一蓝图的所有投射物共用）
+        struct ProjectileVisual
+        {
+            engine::component::Sprite sprite_; ///< @brief 精灵
+            glm::vec2 size_{0.0f};             ///< @brief 大小
+            glm::vec2 offset_{0.0f};           ///< @brief 偏移
+            entt::id_type hit_sound_id_{};     ///< @brief 命中音效ID
+        };
+
         entt::dispatcher &dispatcher_;
-        game::factory::EntityFactory &entity_factory_; ///< @brief 需要传入实体工厂引用，负责创建投射物实体
+        game::factory::BlueprintManager &blueprint_manager_; ///< @brief 蓝图管理器，用于获取投射物的参数与外观
+
+        game::data::ProjectilePool pool_;                            ///< @brief 飞行中的投射物（SoA）
+        std::vector<ProjectileVisual> visuals_;                      ///< @brief 外观表，投射物池中只保存索引
+        std::unordered_map<entt::id_type, uint16_t> visual_indices_; ///< @brief 投射物蓝图ID -> 外观索引
 
     public:
-        ProjectileSystem(entt::registry &registry, entt::dispatcher &dispatcher, game::factory::EntityFactory &entity_factory);
+        ProjectileSystem(entt::dispatcher &dispatcher, game::factory::BlueprintManager &blueprint_manager);
         ~ProjectileSystem();
 
         void update(float delta_time);
 
+        /// @brief 绘制所有飞行中的投射物
+        void render(engine::render::Renderer &renderer, const engine::render::Camera &camera) const;
+
+        game::data::ProjectilePool &getPool() { return pool_; }
+
     private:
+        /// @brief 获取（首次使用时创建）投射物蓝图对应的外观索引
+        uint16_t getVisualIndex(entt::id_type id);
+
         // 事件回调函数
         void onEmitProjectileEvent(const game::defs::EmitProjectileEvent &event);
     };
 
-}
\ No newline at end of file
+}
@@ -1,20 +1,120 @@
 #include "remove_dead_system.h"
 #include "../defs/tags.h"
+#include "../data/dead_queue.h"
+#include "../component/blocker_component.h"
+#include "../component/blocked_by_component.h"
+#include "../component/place_occupied_component.h"
+#include "../component/skill_component.h"
+#include "../factory/entity_factory.h"
 #include <entt/entity/registry.hpp>
-#include <spdlog/spdlog.h>
+#include "../../engine/utils/log.h"
+#include "../../engine/utils/frame_arena.h"
+#include <algorithm>
+#include <memory_resource>
+#include <vector>
 
 namespace game::system
 {
 
+    RemoveDeadSystem::RemoveDeadSystem(game::factory::EntityFactory &entity_factory)
+        : entity_factory_(entity_factory) {}
+
     void RemoveDeadSystem::update(entt::registry &registry)
     {
-        // 标签本质上是空的组件，因此操作逻辑和组件一样
-        auto view = registry.view<game::defs::DeadTag>();
-        for (auto entity : view)
+        auto &dead_queue = registry.ctx().get<game::data::DeadQueue>();
+        auto &stats = dead_queue.getStats();
+        stats.destroyed_ = 0;
+        stats.recycled_ = 0;
+
+        batch_.clear();
+        dead_queue.swap(batch_);
+        if (batch_.empty())
+            return;
+
+        // 按ID排序去重（销毁时访问存储更连续，清理钩子中也可以二分查找）
+        sortBatch();
+        // 批量执行清理钩子，技能标识会被追加到批次中，因此需要再次排序
+        releaseBlockers(registry);
+        releasePlaces(registry);
+        if (releaseSkillDisplays(registry) > 0)
+        {
+            sortBatch();
+        }
+
+        // 池化实体（投射物、特效等）回收复用，其它实体批量销毁
+        destroyed_.clear();
+        for (auto entity : batch_)
+        {
+            if (!registry.valid(entity))
+                continue;
+            if (entity_factory_.recycle(entity))
+            {
+                ++stats.recycled_;
+                continue;
+            }
+            destroyed_.push_back(entity);
+        }
+        registry.destroy(destroyed_.begin(), destroyed_.end());
+
+        stats.destroyed_ = destroyed_.size();
+        stats.total_destroyed_ += stats.destroyed_;
+        stats.total_recycled_ += stats.recycled_;
+        MW_LOG_DEBUG(ENTITY, "RemoveDeadSystem::update destroyed: {}, recycled: {}", stats.destroyed_, stats.recycled_);
+    }
+
+    void RemoveDeadSystem::releaseBlockers(entt::registry &registry)
+    {
+        for (auto entity : batch_)
         {
-            registry.destroy(entity);
-            spdlog::info("RemoveDeadSystem::update clean entity: {}", entt::to_integral(entity));
+            auto blocked_by = registry.try_get<game::component::BlockedByComponent>(entity);
+            if (!blocked_by || !registry.valid(blocked_by->entity_))
+                continue;
+            if (auto blocker = registry.try_get<game::component::BlockerComponent>(blocked_by->entity_); blocker)
+            {
+                blocker->current_count_ = std::max(0, blocker->current_count_ - 1);
+            }
         }
     }
 
-}
\ No newline at end of file
+    void RemoveDeadSystem::releasePlaces(entt::registry &registry)
+    {
+        // 放置点数量很少，遍历一次放置点，在（已排序的）死亡实体中查找占用者（临时列表使用帧内存）
+        std::pmr::vector<entt::entity> released{&registry.ctx().get<engine::utils::FrameArena &>()};
+        for (auto [place, occupied] : registry.view<game::component::PlaceOccupiedComponent>().each())
+        {
+            if (std::binary_search(batch_.begin(), batch_.end(), occupied.entity_))
+            {
+                released.push_back(place);
+            }
+        }
+        registry.remove<game::component::PlaceOccupiedComponent>(released.begin(), released.end());
+        if (!released.empty())
+        {
+            MW_LOG_DEBUG(ENTITY, "释放了 {} 个放置点的占用", released.size());
+        }
+    }
+
+    size_t RemoveDeadSystem::releaseSkillDisplays(entt::registry &registry)
+    {
+        const auto count = batch_.size(); // 只处理原有的实体，追加的技能标识不需要再检查
+        for (size_t i = 0; i < count; ++i)
+        {
+            auto skill = registry.try_get<game::component::SkillComponent>(batch_[i]);
+            if (!skill || skill->display_entity_ == entt::null)
+                continue;
+            if (registry.valid(skill->display_entity_))
+            {
+                batch_.push_back(skill->display_entity_);
+            }
+            skill->display_entity_ = entt::null;
+        }
+        return batch_.size() - count;
+    }
+
+    void RemoveDeadSystem::sortBatch()
+    {
+        std::sort(batch_.begin(), batch_.end());
+        batch_.erase(std::unique(batch_.begin(), batch_.end()), batch_.end());
+    }
+
+}
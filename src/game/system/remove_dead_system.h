@@ -1,16 +1,39 @@
 #pragma once
 #include <entt/entity/fwd.hpp>
+#include <cstddef>
+#include <vector>
+
+namespace game::factory
+{
+    class EntityFactory;
+}
 
 namespace game::system
 {
 
     /**
      * @brief 清理死亡实体的系统
+     *
+     * 处理DeadQueue中上一帧标记的实体：先批量执行清理钩子（释放阻挡计数、放置点占用、技能标识），
+     * 再将池化实体回收到EntityFactory的对象池，其余实体按ID排序后一次性销毁，并记录每帧清理数量。
      */
     class RemoveDeadSystem
     {
+        game::factory::EntityFactory &entity_factory_;
+        std::vector<entt::entity> batch_;     ///< @brief 本帧需要处理的实体（复用容量）
+        std::vector<entt::entity> destroyed_; ///< @brief 本帧需要销毁（非池化）的实体
+
     public:
+        RemoveDeadSystem(game::factory::EntityFactory &entity_factory);
         void update(entt::registry &registry);
+
+    private:
+        // --- 清理钩子（对整批实体执行一次） ---
+        void releaseBlockers(entt::registry &registry);        ///< @brief 被阻挡的敌人死亡时，减少阻挡者的阻挡计数
+        void releasePlaces(entt::registry &registry);          ///< @brief 玩家单位移除时，释放其占用的放置点
+        size_t releaseSkillDisplays(entt::registry &registry); ///< @brief 玩家单位移除时，一并回收其技能标识实体，返回追加的实体数量
+
+        void sortBatch(); ///< @brief 批次按实体ID排序并去重
     };
 
-}
\ No newline at end of file
+}
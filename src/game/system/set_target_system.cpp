@@ -8,11 +8,23 @@
 #include "../../engine/component/transform_component.h"
 #include "../../engine/utils/math.h"
 #include <entt/entity/registry.hpp>
-#include <spdlog/spdlog.h>
+#include "../../engine/utils/log.h"
 
 namespace game::system
 {
 
+    template <typename View>
+    void SetTargetSystem::collectCandidates(View &view)
+    {
+        candidate_positions_.clear();
+        candidate_entities_.clear();
+        for (auto entity : view)
+        {
+            candidate_positions_.push(view.template get<engine::component::TransformComponent>(entity).position_);
+            candidate_entities_.push_back(entity);
+        }
+    }
+
     void SetTargetSystem::update(entt::registry &registry)
     {
         updateHasTarget(registry);
@@ -38,7 +50,7 @@ namespace game::system
             {
                 // 如果目标实体无效，则清除目标
                 registry.remove<game::component::TargetComponent>(entity);
-                spdlog::info("ID: {}, Target: ID: {}, Invalid, Clear Target",
+                MW_LOG_DEBUG(TARGETING, "ID: {}, Target: ID: {}, Invalid, Clear Target",
                              entt::to_integral(entity),
                              entt::to_integral(target.entity_));
                 continue;
@@ -50,7 +62,7 @@ namespace game::system
             {
                 // 如果在攻击范围外，则清除目标
                 registry.remove<game::component::TargetComponent>(entity);
-                spdlog::info("ID: {}, Target: ID: {}, is out of attack range, clearing target", entt::to_integral(entity), entt::to_integral(target.entity_));
+                MW_LOG_DEBUG(TARGETING, "ID: {}, Target: ID: {}, is out of attack range, clearing target", entt::to_integral(entity), entt::to_integral(target.entity_));
                 continue;
             }
         }
@@ -62,25 +74,25 @@ namespace game::system
         auto view_player_no_target = registry.view<engine::component::TransformComponent,
                                                    game::component::StatsComponent,
                                                    game::component::PlayerComponent>(entt::exclude<game::component::TargetComponent, game::defs::HealerTag>);
-        // 获取所有敌方角色用于检测
+        // 获取所有敌方角色用于检测，收集为SoA数据
         auto view_enemy = registry.view<engine::component::TransformComponent, game::component::EnemyComponent>();
+        collectCandidates(view_enemy);
         // 遍历每一个没有目标的玩家攻击型角色
         for (auto player_entity : view_player_no_target)
         {
             const auto &player_transform = view_player_no_target.get<engine::component::TransformComponent>(player_entity);
             const auto &player_stats = view_player_no_target.get<game::component::StatsComponent>(player_entity);
-            // 检查敌人是否在攻击范围之内
-            for (auto enemy_entity : view_enemy)
+            // 检查敌人是否在攻击范围之内（批量检测，取第一个命中的敌人）
+            auto range_radius = player_stats.range_ + game::defs::UNIT_RADIUS;
+            auto index = engine::utils::findFirstInRadius(player_transform.position_, range_radius * range_radius,
+                                                          candidate_positions_.x.data(), candidate_positions_.y.data(),
+                                                          candidate_positions_.size());
+            if (index < candidate_entities_.size())
             {
-                const auto &enemy_transform = view_enemy.get<engine::component::TransformComponent>(enemy_entity);
-                auto range_radius = player_stats.range_ + game::defs::UNIT_RADIUS;
-                if (engine::utils::distanceSquared(player_transform.position_, enemy_transform.position_) <= range_radius * range_radius)
-                {
-                    // 如果敌人在攻击范围之内，则设置目标
-                    registry.emplace<game::component::TargetComponent>(player_entity, enemy_entity);
-                    spdlog::info("Player: ID: {}, Target Set: ID: {}", entt::to_integral(player_entity), entt::to_integral(enemy_entity));
-                    break; // 设置一个目标敌人就停止检查
-                }
+                // 如果敌人在攻击范围之内，则设置目标
+                auto enemy_entity = candidate_entities_[index];
+                registry.emplace<game::component::TargetComponent>(player_entity, enemy_entity);
+                MW_LOG_DEBUG(TARGETING, "Player: ID: {}, Target Set: ID: {}", entt::to_integral(player_entity), entt::to_integral(enemy_entity));
             }
         }
     }
@@ -92,25 +104,25 @@ namespace game::system
                                                   engine::component::TransformComponent,
                                                   game::component::StatsComponent,
                                                   game::defs::RangedUnitTag>(entt::exclude<game::component::TargetComponent>);
-        // 获取所有玩家角色用于检测
+        // 获取所有玩家角色用于检测，收集为SoA数据
         auto view_player = registry.view<engine::component::TransformComponent, game::component::PlayerComponent>();
+        collectCandidates(view_player);
         // 遍历每一个没有目标的敌人角色
         for (auto enemy_entity : view_enemy_no_target)
         {
             const auto &enemy_transform = view_enemy_no_target.get<engine::component::TransformComponent>(enemy_entity);
             const auto &enemy_stats = view_enemy_no_target.get<game::component::StatsComponent>(enemy_entity);
-            // 检查玩家角色是否在攻击范围之内
-            for (auto player_entity : view_player)
+            // 检查玩家角色是否在攻击范围之内（批量检测，取第一个命中的玩家角色）
+            auto range_radius = enemy_stats.range_ + game::defs::UNIT_RADIUS;
+            auto index = engine::utils::findFirstInRadius(enemy_transform.position_, range_radius * range_radius,
+                                                          candidate_positions_.x.data(), candidate_positions_.y.data(),
+                                                          candidate_positions_.size());
+            if (index < candidate_entities_.size())
             {
-                const auto &player_transform = view_player.get<engine::component::TransformComponent>(player_entity);
-                auto range_radius = enemy_stats.range_ + game::defs::UNIT_RADIUS;
-                if (engine::utils::distanceSquared(enemy_transform.position_, player_transform.position_) <= range_radius * range_radius)
-                {
-                    // 如果玩家角色在攻击范围之内，则设置目标
-                    registry.emplace<game::component::TargetComponent>(enemy_entity, player_entity);
-                    spdlog::info("Enemy: ID: {}, Target set: ID: {}", entt::to_integral(enemy_entity), entt::to_integral(player_entity));
-                    break; // 设置一个目标玩家角色就停止检查
-                }
+                // 如果玩家角色在攻击范围之内，则设置目标
+                auto player_entity = candidate_entities_[index];
+                registry.emplace<game::component::TargetComponent>(enemy_entity, player_entity);
+                MW_LOG_DEBUG(TARGETING, "Enemy: ID: {}, Target set: ID: {}", entt::to_integral(enemy_entity), entt::to_integral(player_entity));
             }
         }
     }
@@ -128,6 +140,8 @@ namespace game::system
                                                  game::component::StatsComponent,
                                                  game::defs::InjuredTag,
                                                  engine::component::TransformComponent>();
+        collectCandidates(view_injured_player);
+        hit_indices_.resize(candidate_entities_.size());
         // 遍历每一个治疗者
         for (auto healer_entity : view_healer)
         {
@@ -136,22 +150,22 @@ namespace game::system
             // ---获取血量百分比最低的玩家角色---
             float lowest_hp_percent = 1.0f;             // 保存最低血量百分比（初始为100%）
             entt::entity lowest_hp_player = entt::null; // 保存最低血量百分比的玩家角色（初始为空）
-            // 遍历每一个受伤玩家角色
-            for (auto player_entity : view_injured_player)
+            // 批量检测处于治疗者范围内的受伤玩家角色
+            auto range_radius = healer_stats.range_ + game::defs::UNIT_RADIUS;
+            // 治疗范围不包含边界（距离必须严格小于半径），与攻击型角色的 <= 不同
+            auto hit_count = engine::utils::radiusTestMany(healer_transform.position_, range_radius * range_radius,
+                                                           candidate_positions_.x.data(), candidate_positions_.y.data(),
+                                                           candidate_positions_.size(), hit_indices_.data(), false);
+            for (size_t i = 0; i < hit_count; ++i)
             {
-                // 如果处于治疗者攻击范围内
-                const auto &player_transform = view_injured_player.get<engine::component::TransformComponent>(player_entity);
-                auto range_radius = healer_stats.range_ + game::defs::UNIT_RADIUS;
-                if (engine::utils::distanceSquared(healer_transform.position_, player_transform.position_) < range_radius * range_radius)
+                // 计算血量百分比并更新最低百分比和目标角色
+                auto player_entity = candidate_entities_[hit_indices_[i]];
+                const auto &player_stats = view_injured_player.get<game::component::StatsComponent>(player_entity);
+                auto hp_percent = static_cast<float>(player_stats.hp_) / static_cast<float>(player_stats.max_hp_);
+                if (hp_percent < lowest_hp_percent)
                 {
-                    // 计算血量百分比并更新最低百分比和目标角色
-                    const auto &player_stats = view_injured_player.get<game::component::StatsComponent>(player_entity);
-                    auto hp_percent = static_cast<float>(player_stats.hp_) / static_cast<float>(player_stats.max_hp_);
-                    if (hp_percent < lowest_hp_percent)
-                    {
-                        lowest_hp_percent = hp_percent;
-                        lowest_hp_player = player_entity;
-                    }
+                    lowest_hp_percent = hp_percent;
+                    lowest_hp_player = player_entity;
                 }
             }
             // 如果找到了最低血量百分比的玩家角色，则设置目标
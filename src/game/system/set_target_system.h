@@ -1,5 +1,7 @@
 #pragma once
+#include "../../engine/utils/batch_math.h"
 #include <entt/entity/fwd.hpp>
+#include <vector>
 
 namespace game::system
 {
@@ -9,6 +11,11 @@ namespace game::system
      */
     class SetTargetSystem
     {
+        // --- 候选目标的位置（SoA），每次检测前收集一次，供批量半径检测使用 ---
+        engine::utils::Vec2SoA candidate_positions_;
+        std::vector<entt::entity> candidate_entities_;
+        std::vector<uint32_t> hit_indices_; ///< @brief 批量半径检测命中的候选索引
+
     public:
         void update(entt::registry &registry);
 
@@ -18,6 +25,10 @@ namespace game::system
         void updateNoTargetPlayer(entt::registry &registry); ///< @brief 处理没有目标的玩家攻击型角色
         void updateNoTargetEnemy(entt::registry &registry);  ///< @brief 处理没有目标的敌人角色
         void updateHealer(entt::registry &registry);         ///< @brief 处理治疗者
+
+        /// @brief 按view顺序收集候选目标的位置与实体
+        template <typename View>
+        void collectCandidates(View &view);
     };
 
 }
\ No newline at end of file
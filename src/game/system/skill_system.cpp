@@ -1,6 +1,7 @@
 #include "skill_system.h"
 #include "../defs/events.h"
 #include "../defs/tags.h"
+#include "../data/dead_queue.h"
 #include "../factory/entity_factory.h"
 #include "../factory/blueprint_manager.h"
 #include "../component/skill_component.h"
@@ -28,7 +29,6 @@ namespace game::system
         dispatcher_.sink<game::defs::SkillReadyEvent>().connect<&SkillSystem::onSkillReadyEvent>(this);
         dispatcher_.sink<game::defs::SkillActiveEvent>().connect<&SkillSystem::onSkillActiveEvent>(this);
         dispatcher_.sink<game::defs::SkillDurationEndEvent>().connect<&SkillSystem::onSkillDurationEndEvent>(this);
-        dispatcher_.sink<game::defs::RemovePlayerUnitEvent>().connect<&SkillSystem::onRemoveUnitEvent>(this);
     }
 
     // 事件回调函数
@@ -42,7 +42,7 @@ namespace game::system
         // 先删除可能存在的显示实体
         if (skill.display_entity_ != entt::null && registry_.valid(skill.display_entity_))
         {
-            registry_.emplace_or_replace<game::defs::DeadTag>(skill.display_entity_);
+            game::data::markDead(registry_, skill.display_entity_);
         }
         // 创建新的显示实体 (技能准备就绪)
         skill.display_entity_ = entity_factory_.createSkillDisplay("skill_ready"_hs, transform.position_ + game::defs::SKILL_DISPLAY_OFFSET);
@@ -62,7 +62,7 @@ namespace game::system
         // 删除可能存在的显示实体
         if (skill.display_entity_ != entt::null && registry_.valid(skill.display_entity_))
         {
-            registry_.emplace_or_replace<game::defs::DeadTag>(skill.display_entity_);
+            game::data::markDead(registry_, skill.display_entity_);
         }
         // 创建新的显示实体 (技能激活)
         skill.display_entity_ = entity_factory_.createSkillDisplay("skill_active"_hs, transform.position_ + game::defs::SKILL_DISPLAY_OFFSET);
@@ -90,8 +90,10 @@ namespace game::system
         // 删除技能显示实体
         if (skill.display_entity_ != entt::null && registry_.valid(skill.display_entity_))
         {
-            registry_.emplace_or_replace<game::defs::DeadTag>(skill.display_entity_);
+            game::data::markDead(registry_, skill.display_entity_);
         }
+        // 显示实体会被回收复用（句柄仍然有效），因此需要清空，避免之后误删其它用途的实体
+        skill.display_entity_ = entt::null;
 
         // 移除技能激活标签
         registry_.remove<game::defs::SkillActiveTag>(event.entity_);
@@ -106,20 +108,6 @@ namespace game::system
         removeBuff(event.entity_, skill.skill_id_);
     }
 
-    void SkillSystem::onRemoveUnitEvent(const game::defs::RemovePlayerUnitEvent &event)
-    {
-        if (event.entity_ == entt::null || !registry_.valid(event.entity_))
-            return;
-        // 移除技能显示实体
-        if (auto skill = registry_.try_get<game::component::SkillComponent>(event.entity_); skill)
-        {
-            if (skill->display_entity_ != entt::null && registry_.valid(skill->display_entity_))
-            {
-                registry_.emplace_or_replace<game::defs::DeadTag>(skill->display_entity_);
-            }
-        }
-    }
-
     // Buff增删函数
     void SkillSystem::addBuff(entt::entity entity, entt::id_type skill_id)
     {
@@ -132,12 +120,15 @@ namespace game::system
         const auto &buff_blueprint = skill_blueprint.buff_;
 
         // 将Buff应用到角色的Stats中
-        auto &stats = registry_.get<game::component::StatsComponent>(entity);
-        stats.hp_ *= buff_blueprint.hp_multiplier_;
-        stats.atk_ *= buff_blueprint.atk_multiplier_;
-        stats.def_ *= buff_blueprint.def_multiplier_;
-        stats.range_ *= buff_blueprint.range_multiplier_;
-        stats.atk_interval_ *= buff_blueprint.atk_interval_multiplier_;
+        // 使用patch修改，TimerSystem会根据新的攻击间隔调整攻击冷却
+        registry_.patch<game::component::StatsComponent>(entity, [&buff_blueprint](auto &stats)
+                                                         {
+                                                             stats.hp_ *= buff_blueprint.hp_multiplier_;
+                                                             stats.atk_ *= buff_blueprint.atk_multiplier_;
+                                                             stats.def_ *= buff_blueprint.def_multiplier_;
+                                                             stats.range_ *= buff_blueprint.range_multiplier_;
+                                                             stats.atk_interval_ *= buff_blueprint.atk_interval_multiplier_;
+                                                         });
 
         // 若存在Cost相关Buff，则添加COST恢复组件
         if (buff_blueprint.cost_regen_ > 0.0f)
@@ -156,12 +147,15 @@ namespace game::system
         const auto &buff_blueprint = skill_blueprint.buff_;
 
         // 从角色的Stats中移除Buff
-        auto &stats = registry_.get<game::component::StatsComponent>(entity);
-        stats.hp_ /= buff_blueprint.hp_multiplier_;
-        stats.atk_ /= buff_blueprint.atk_multiplier_;
-        stats.def_ /= buff_blueprint.def_multiplier_;
-        stats.range_ /= buff_blueprint.range_multiplier_;
-        stats.atk_interval_ /= buff_blueprint.atk_interval_multiplier_;
+        // 使用patch修改，TimerSystem会根据新的攻击间隔调整攻击冷却
+        registry_.patch<game::component::StatsComponent>(entity, [&buff_blueprint](auto &stats)
+                                                         {
+                                                             stats.hp_ /= buff_blueprint.hp_multiplier_;
+                                                             stats.atk_ /= buff_blueprint.atk_multiplier_;
+                                                             stats.def_ /= buff_blueprint.def_multiplier_;
+                                                             stats.range_ /= buff_blueprint.range_multiplier_;
+                                                             stats.atk_interval_ /= buff_blueprint.atk_interval_multiplier_;
+                                                         });
 
         // 若存在Cost相关Buff，则移除COST恢复组件
         if (buff_blueprint.cost_regen_ > 0.0f)
@@ -30,7 +30,6 @@ namespace game::system
         void onSkillReadyEvent(const game::defs::SkillReadyEvent &event);
         void onSkillActiveEvent(const game::defs::SkillActiveEvent &event);
         void onSkillDurationEndEvent(const game::defs::SkillDurationEndEvent &event);
-        void onRemoveUnitEvent(const game::defs::RemovePlayerUnitEvent &event);
 
         // Buff增删函数
         void addBuff(entt::entity entity, entt::id_type skill_id);
@@ -1,8 +1,10 @@
 #include "timer_system.h"
 #include "../component/stats_component.h"
 #include "../component/skill_component.h"
+#include "../data/game_stats.h"
 #include "../defs/tags.h"
 #include "../defs/events.h"
+#include "../defs/constants.h"
 #include <entt/entity/registry.hpp>
 #include <entt/signal/dispatcher.hpp>
 #include <spdlog/spdlog.h>
@@ -10,71 +12,142 @@
 namespace game::system
 {
 
-    void TimerSystem::updateAttackTimer(float delta_time)
+    TimerSystem::TimerSystem(entt::registry &registry, entt::dispatcher &dispatcher)
+        : registry_(registry),
+          dispatcher_(dispatcher),
+          game_stats_(registry.ctx().get<game::data::GameStats &>())
+    {
+        registry_.on_construct<game::component::StatsComponent>().connect<&TimerSystem::onStatsConstruct>(this);
+        registry_.on_update<game::component::StatsComponent>().connect<&TimerSystem::onStatsUpdate>(this);
+        registry_.on_destroy<game::defs::AttackReadyTag>().connect<&TimerSystem::onAttackReadyDestroy>(this);
+        registry_.on_construct<game::component::SkillComponent>().connect<&TimerSystem::onSkillConstruct>(this);
+        registry_.on_destroy<game::defs::SkillReadyTag>().connect<&TimerSystem::onSkillReadyDestroy>(this);
+        registry_.on_construct<game::defs::SkillActiveTag>().connect<&TimerSystem::onSkillActiveConstruct>(this);
+    }
+
+    TimerSystem::~TimerSystem()
+    {
+        registry_.on_construct<game::component::StatsComponent>().disconnect(this);
+        registry_.on_update<game::component::StatsComponent>().disconnect(this);
+        registry_.on_destroy<game::defs::AttackReadyTag>().disconnect(this);
+        registry_.on_construct<game::component::SkillComponent>().disconnect(this);
+        registry_.on_destroy<game::defs::SkillReadyTag>().disconnect(this);
+        registry_.on_construct<game::defs::SkillActiveTag>().disconnect(this);
+    }
+
+    void TimerSystem::update(float delta_time)
+    {
+        // 推进游戏时间，只弹出到期的计时器
+        game_stats_.game_time_ += delta_time;
+        timers_.popExpired(game_stats_.game_time_, [this](float, const Timer &timer)
+                           { fireTimer(timer); });
+    }
+
+    void TimerSystem::fireTimer(const Timer &timer)
     {
+        const auto entity = timer.entity_;
+        if (!registry_.valid(entity))
+            return;
+        const auto now = game_stats_.game_time_;
 
-        auto view_unit = registry_.view<game::component::StatsComponent>(entt::exclude<game::defs::AttackReadyTag>);
-        for (auto entity : view_unit)
+        switch (timer.type_)
+        {
+        case TimerType::ATTACK:
         {
-            auto &stats = view_unit.get<game::component::StatsComponent>(entity);
-            stats.atk_timer_ += delta_time; // 推进计时器
-            // 如果攻击计时器大于等于攻击间隔，代表冷却结束。添加“可攻击”标签，并重置攻击计时器
-            if (stats.atk_timer_ >= stats.atk_interval_)
+            // 开始时间不一致说明已被新的计时器取代；已经可攻击则无需处理
+            auto stats = registry_.try_get<game::component::StatsComponent>(entity);
+            if (!stats || stats->atk_start_time_ != timer.start_time_ || registry_.all_of<game::defs::AttackReadyTag>(entity))
+                return;
+            // 攻击间隔可能被Buff延长，此时按新的截止时间重新入队
+            if (const auto deadline = stats->atk_start_time_ + stats->atk_interval_; deadline > now)
             {
-                registry_.emplace_or_replace<game::defs::AttackReadyTag>(entity);
-                stats.atk_timer_ = 0.0f;
+                timers_.push(deadline, timer);
+                return;
             }
+            // 冷却结束，添加“可攻击”标签
+            registry_.emplace<game::defs::AttackReadyTag>(entity);
+            break;
+        }
+        case TimerType::SKILL_COOLDOWN:
+        {
+            // 被动技能不需要冷却；已就绪或计时器已被取代时忽略
+            auto skill = registry_.try_get<game::component::SkillComponent>(entity);
+            if (!skill || skill->cooldown_start_time_ != timer.start_time_ ||
+                registry_.any_of<game::defs::SkillReadyTag, game::defs::PassiveSkillTag>(entity))
+                return;
+            // 冷却结束，添加“可施放”标签，并发送技能准备就绪事件
+            registry_.emplace<game::defs::SkillReadyTag>(entity);
+            dispatcher_.enqueue(game::defs::SkillReadyEvent{entity});
+            break;
+        }
+        case TimerType::SKILL_DURATION:
+        {
+            // 技能已结束（或为被动技能）时忽略
+            auto skill = registry_.try_get<game::component::SkillComponent>(entity);
+            if (!skill || skill->duration_start_time_ != timer.start_time_ ||
+                !registry_.all_of<game::defs::SkillActiveTag>(entity) || registry_.all_of<game::defs::PassiveSkillTag>(entity))
+                return;
+            // 持续结束，移除“技能激活”标签，并发送技能持续结束事件
+            registry_.remove<game::defs::SkillActiveTag>(entity);
+            dispatcher_.enqueue(game::defs::SkillDurationEndEvent{entity});
+            break;
+        }
         }
     }
 
-    TimerSystem::TimerSystem(entt::registry &registry, entt::dispatcher &dispatcher)
-        : registry_(registry), dispatcher_(dispatcher)
+    void TimerSystem::scheduleAttack(entt::entity entity)
     {
+        auto &stats = registry_.get<game::component::StatsComponent>(entity);
+        stats.atk_start_time_ = game_stats_.game_time_;
+        timers_.push(stats.atk_start_time_ + stats.atk_interval_, Timer{entity, TimerType::ATTACK, stats.atk_start_time_});
     }
 
-    void TimerSystem::update(float delta_time)
+    void TimerSystem::onStatsConstruct(entt::registry &, entt::entity entity)
     {
-        updateAttackTimer(delta_time);
-        updateSkillCooldownTimer(delta_time);
-        updateSkillDurationTimer(delta_time);
+        scheduleAttack(entity);
     }
 
-    void TimerSystem::updateSkillCooldownTimer(float delta_time)
+    void TimerSystem::onStatsUpdate(entt::registry &, entt::entity entity)
     {
-        // 筛选条件：有SkillComponent组件，但没有SkillReadyTag标签（即技能正在冷却），排除被动技能
-        auto view_skill = registry_.view<game::component::SkillComponent>(
-            entt::exclude<game::defs::SkillReadyTag, game::defs::PassiveSkillTag>);
-        for (auto entity : view_skill)
+        // 攻击间隔缩短时需要提前到期（间隔延长的情况在到期时处理），旧的计时器会在到期时被忽略
+        if (registry_.all_of<game::defs::AttackReadyTag>(entity))
+            return;
+        const auto &stats = registry_.get<game::component::StatsComponent>(entity);
+        timers_.push(stats.atk_start_time_ + stats.atk_interval_, Timer{entity, TimerType::ATTACK, stats.atk_start_time_});
+    }
+
+    void TimerSystem::onAttackReadyDestroy(entt::registry &, entt::entity entity)
+    {
+        // 实体销毁时也会触发，此时无需计时
+        if (registry_.all_of<game::component::StatsComponent>(entity))
         {
-            auto &skill = view_skill.get<game::component::SkillComponent>(entity);
-            skill.cooldown_timer_ += delta_time;
-            // 如果技能冷却计时器大于等于技能冷却时间，代表冷却结束。添加“可施放”标签，并重置技能冷却计时器
-            if (skill.cooldown_timer_ >= skill.cooldown_)
-            {
-                registry_.emplace_or_replace<game::defs::SkillReadyTag>(entity);
-                skill.cooldown_timer_ = 0.0f;
-                // 发送技能准备就绪事件
-                dispatcher_.enqueue(game::defs::SkillReadyEvent{entity});
-            }
+            scheduleAttack(entity);
         }
     }
-    void TimerSystem::updateSkillDurationTimer(float delta_time)
+
+    void TimerSystem::onSkillConstruct(entt::registry &, entt::entity entity)
     {
-        // 筛选条件：有SkillComponent组件，且有SkillActiveTag标签（即技能正在激活中），排除被动技能
-        auto view_skill = registry_.view<game::component::SkillComponent,
-                                         game::defs::SkillActiveTag>(entt::exclude<game::defs::PassiveSkillTag>);
-        for (auto entity : view_skill)
+        // 初始技能冷却时间为技能冷却时间的一半（被动技能的计时器会在到期时被忽略）
+        auto &skill = registry_.get<game::component::SkillComponent>(entity);
+        skill.cooldown_start_time_ = game_stats_.game_time_ - skill.cooldown_ * game::defs::SKILL_INITIAL_COOLDOWN_RATIO;
+        timers_.push(skill.cooldown_start_time_ + skill.cooldown_, Timer{entity, TimerType::SKILL_COOLDOWN, skill.cooldown_start_time_});
+    }
+
+    void TimerSystem::onSkillReadyDestroy(entt::registry &, entt::entity entity)
+    {
+        if (auto skill = registry_.try_get<game::component::SkillComponent>(entity); skill)
         {
-            auto &skill = view_skill.get<game::component::SkillComponent>(entity);
-            skill.duration_timer_ += delta_time;
-            // 如果技能持续计时器大于等于技能持续时间，代表持续结束。移除“技能激活”标签，并重置技能持续计时器
-            if (skill.duration_timer_ >= skill.duration_)
-            {
-                registry_.remove<game::defs::SkillActiveTag>(entity);
-                skill.duration_timer_ = 0.0f;
-                // 发送技能持续结束事件
-                dispatcher_.enqueue(game::defs::SkillDurationEndEvent{entity});
-            }
+            skill->cooldown_start_time_ = game_stats_.game_time_;
+            timers_.push(skill->cooldown_start_time_ + skill->cooldown_, Timer{entity, TimerType::SKILL_COOLDOWN, skill->cooldown_start_time_});
+        }
+    }
+
+    void TimerSystem::onSkillActiveConstruct(entt::registry &, entt::entity entity)
+    {
+        if (auto skill = registry_.try_get<game::component::SkillComponent>(entity); skill)
+        {
+            skill->duration_start_time_ = game_stats_.game_time_;
+            timers_.push(skill->duration_start_time_ + skill->duration_, Timer{entity, TimerType::SKILL_DURATION, skill->duration_start_time_});
         }
     }
-}
\ No newline at end of file
+}
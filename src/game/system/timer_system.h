@@ -1,27 +1,67 @@
 #pragma once
+#include "../../engine/utils/timer_queue.h"
 #include <entt/entity/fwd.hpp>
 #include <entt/signal/fwd.hpp>
+#include <cstdint>
+
+namespace game::data
+{
+    struct GameStats;
+}
+
 namespace game::system
 {
 
     /**
-     * @brief 计时器系统，用于更新所有包含计时器的组件，
-     * 并在满足条件时添加必要的标签，（如攻击冷却完成后，添加“可攻击”标签）。
+     * @brief 计时器系统，管理攻击冷却、技能冷却与技能持续时间，
+     * 并在到期时添加必要的标签，（如攻击冷却完成后，添加“可攻击”标签）。
+     *
+     * 计时器只在开始时注册一次（通过注册表的组件/标签构造与销毁信号），按截止时间保存在最小堆中，
+     * 每帧只处理到期的计时器，开销与到期数量成正比，而不是与单位数量成正比。
+     * 组件中保存计时开始的游戏时间，截止时间 = 开始时间 + 间隔，因此间隔被Buff修改后依然正确（需通过patch修改StatsComponent）。
      */
     class TimerSystem
     {
+        /// @brief 计时器类型
+        enum class TimerType : uint8_t
+        {
+            ATTACK,         ///< @brief 攻击冷却
+            SKILL_COOLDOWN, ///< @brief 技能冷却
+            SKILL_DURATION  ///< @brief 技能持续
+        };
+        /// @brief 计时器数据（开始时间用于判断计时器是否已被新的计时器取代）
+        struct Timer
+        {
+            entt::entity entity_;
+            TimerType type_;
+            float start_time_;
+        };
+
         entt::registry &registry_;
         entt::dispatcher &dispatcher_;
+        game::data::GameStats &game_stats_;       ///< @brief 游戏时间保存在GameStats中（调试UI显示剩余时间时也需要）
+        engine::utils::TimerQueue<Timer> timers_; ///< @brief 按截止时间排序的计时器
 
     public:
         TimerSystem(entt::registry &registry, entt::dispatcher &dispatcher);
+        ~TimerSystem();
 
         void update(float delta_time);
 
+        size_t getTimerCount() const { return timers_.size(); } ///< @brief 队列中的计时器数量（包括已失效、尚未弹出的）
+
     private:
-        void updateAttackTimer(float delta_time);        ///< @brief 处理攻击计时器
-        void updateSkillCooldownTimer(float delta_time); ///< @brief 处理技能冷却计时器
-        void updateSkillDurationTimer(float delta_time); ///< @brief 处理技能持续计时器
+        void fireTimer(const Timer &timer); ///< @brief 处理到期的计时器（过期的计时器直接忽略）
+
+        // --- 信号回调：注册计时器 ---
+        void onStatsConstruct(entt::registry &registry, entt::entity entity);       ///< @brief 新单位开始攻击冷却
+        void onStatsUpdate(entt::registry &registry, entt::entity entity);          ///< @brief 攻击间隔变化时重新计算截止时间
+        void onAttackReadyDestroy(entt::registry &registry, entt::entity entity);   ///< @brief 发起攻击后开始攻击冷却
+        void onSkillConstruct(entt::registry &registry, entt::entity entity);       ///< @brief 新单位开始技能冷却
+        void onSkillReadyDestroy(entt::registry &registry, entt::entity entity);    ///< @brief 施放技能后开始技能冷却
+        void onSkillActiveConstruct(entt::registry &registry, entt::entity entity); ///< @brief 技能激活后开始计算持续时间
+
+        void scheduleAttack(entt::entity entity);
     };
 
-}
\ No newline at end of file
+}
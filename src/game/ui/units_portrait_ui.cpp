@@ -100,6 +100,8 @@ namespace game::ui
         anchor_panel->setBackgroundColor(engine::utils::FColor(0.1f, 0.1f, 0.1f, 0.1f));
         // 设置ID，以后即可根据ID找到该panel
         anchor_panel->setId("anchor_panel"_hs);
+        // 肖像面板大部分时间不变，开启缓存（cost变化导致遮盖显隐、悬停等情况才重新渲染）
+        anchor_panel->setCached(true);
 
         // 依次添加角色肖像，每个肖像显示由四部分依次叠加：portrait，frame，icon，cost，可以通过一个frame_panel定位（位于上层anchor_panel之中）
         int index = 0;
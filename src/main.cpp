@@ -2,23 +2,54 @@
 #include "engine/core/context.h"
 #include "engine/scene/scene_manager.h"
 #include "game/scene/splash_scene.h"
+#include "engine/utils/log.h"
 #include <spdlog/spdlog.h>
 #include <SDL3/SDL_main.h>
 #include <entt/signal/dispatcher.hpp>
 #include "engine/utils/events.h"
+#include "engine/utils/dispatcher_profiler.h"
+#include "game/defs/events.h"
 void setupInitialScene(engine::core::Context &context)
 {
+    // 登记游戏事件类型，在调试UI中查看各事件的分发统计（引擎事件由GameApp登记）
+    context.getDispatcherProfiler().trackAll<game::defs::EnemyArriveHomeEvent,
+                                             game::defs::AttackEvent,
+                                             game::defs::HealEvent,
+                                             game::defs::EmitProjectileEvent,
+                                             game::defs::EnemyDeadEffectEvent,
+                                             game::defs::PrepUnitEvent,
+                                             game::defs::RemoveUIPortraitEvent,
+                                             game::defs::RemovePlayerUnitEvent,
+                                             game::defs::EffectEvent,
+                                             game::defs::SkillReadyEvent,
+                                             game::defs::SkillActiveEvent,
+                                             game::defs::SkillDurationEndEvent,
+                                             game::defs::UIPortraitHoverEnterEvent,
+                                             game::defs::UIPortraitHoverLeaveEvent,
+                                             game::defs::UpgradeUnitEvent,
+                                             game::defs::RetreatEvent,
+                                             game::defs::RestartEvent,
+                                             game::defs::BackToTitleEvent,
+                                             game::defs::SaveEvent,
+                                             game::defs::LevelClearEvent,
+                                             game::defs::LevelClearDelayedEvent,
+                                             game::defs::GameEndEvent>();
+
     auto splash_scene = std::make_unique<game::scene::SplashScene>(context);
     context.getDispatcher().trigger<engine::utils::PushSceneEvent>(engine::utils::PushSceneEvent{std::move(splash_scene)});
 }
 
 int main(int, char *[])
 {
-    spdlog::set_level(spdlog::level::off);
+    // 日志默认全部关闭（异步输出），可在调试UI中按分类开启
+    engine::utils::Log::init(spdlog::level::off);
 
-    engine::core::GameApp app;
+    {
+        engine::core::GameApp app;
 
-    app.registerSceneSutep(setupInitialScene);
-    app.run();
+        app.registerSceneSutep(setupInitialScene);
+        app.run();
+    }
+    engine::utils::Log::shutdown();
     return 0;
 }
@@ -0,0 +1,122 @@
+/**
+ * @brief SmallFlatMap 测试：插入/删除时内部缓冲区与堆存储之间的切换，以及拷贝/移动后的状态
+ */
+#include "../src/engine/utils/small_flat_map.h"
+#include <cstdio>
+#include <utility>
+
+namespace
+{
+    int failures = 0;
+
+#define CHECK(expr)                                                              \
+    do                                                                           \
+    {                                                                            \
+        if (!(expr))                                                             \
+        {                                                                        \
+            std::printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #expr); \
+            ++failures;                                                          \
+        }                                                                        \
+    } while (0)
+
+    using Map = engine::utils::SmallFlatMap<int, int, 4>;
+
+    Map makeMap(int count)
+    {
+        Map map;
+        for (int i = count - 1; i >= 0; --i) // 逆序插入，检查有序性
+        {
+            map.emplace(i, i * 10);
+        }
+        return map;
+    }
+
+    bool isSorted(const Map &map)
+    {
+        int expected = 0;
+        for (const auto &[key, value] : map)
+        {
+            if (key != expected || value != expected * 10)
+                return false;
+            ++expected;
+        }
+        return expected == static_cast<int>(map.size());
+    }
+
+    void testInlineAndSpill()
+    {
+        auto map = makeMap(4);
+        CHECK(map.isInline());
+        CHECK(isSorted(map));
+        map.emplace(4, 40);
+        CHECK(!map.isInline());
+        CHECK(isSorted(map));
+        CHECK(map.contains(4));
+        CHECK(map.erase(4) == 1);
+        CHECK(map.isInline());
+        CHECK(isSorted(map));
+        CHECK(map.erase(4) == 0);
+        CHECK(!map.emplace(1, 99).second);
+        CHECK(map.find(1)->second == 10);
+    }
+
+    void testMovedFromSpilledMap()
+    {
+        auto source = makeMap(8);
+        CHECK(!source.isInline());
+
+        Map moved(std::move(source));
+        CHECK(moved.size() == 8);
+        CHECK(isSorted(moved));
+        // 被移动的对象应为空且可以继续使用
+        CHECK(source.empty());
+        CHECK(source.begin() == source.end());
+        CHECK(!source.contains(3));
+        source.emplace(1, 10);
+        CHECK(source.size() == 1 && source.find(1)->second == 10);
+
+        Map assigned;
+        assigned = std::move(moved);
+        CHECK(assigned.size() == 8);
+        CHECK(isSorted(assigned));
+        CHECK(moved.empty());
+        CHECK(moved.find(5) == moved.end());
+        for (int i = 0; i < 6; ++i)
+        {
+            moved.emplace(i, i * 10);
+        }
+        CHECK(isSorted(moved));
+    }
+
+    void testMovedFromInlineMap()
+    {
+        auto source = makeMap(3);
+        Map moved(std::move(source));
+        CHECK(isSorted(moved));
+        CHECK(source.empty());
+        CHECK(!source.contains(0));
+    }
+
+    void testCopy()
+    {
+        auto source = makeMap(6);
+        Map copy(source);
+        CHECK(isSorted(copy));
+        CHECK(isSorted(source));
+        copy.erase(5);
+        copy.erase(4);
+        CHECK(copy.isInline());
+        CHECK(source.size() == 6);
+    }
+}
+
+int main()
+{
+    testInlineAndSpill();
+    testMovedFromSpilledMap();
+    testMovedFromInlineMap();
+    testCopy();
+    if (failures == 0)
+        std::printf("small_flat_map_test: all passed\n");
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,47 @@
+/**
+ * @brief mw-mapc: 离线地图编译器
+ *
+ * 将 Tiled 地图 (.tmj) 及其引用的图块集 (.tsj) 编译为二进制关卡文件 (.mwl)，
+ * 输出文件与地图文件同目录同名。LevelLoader 会优先加载 .mwl，不存在或过期时回退到 .tmj。
+ *
+ * 用法: mw-mapc <map.tmj> [map2.tmj ...]
+ */
+#include "../../src/engine/loader/level_binary.h"
+#include <spdlog/spdlog.h>
+
+namespace
+{
+    bool compileMap(const std::string &map_path)
+    {
+        // 解析地图并内嵌引用的图块集，然后写出二进制关卡
+        engine::loader::LevelBinary level;
+        if (!level.loadFromMap(map_path))
+            return false;
+
+        const auto output_path = engine::loader::LevelBinary::getBinaryPath(map_path);
+        if (!level.saveToFile(output_path))
+            return false;
+
+        spdlog::info("{} -> {} ({} layers, {} tilesets)", map_path, output_path, level.layers_.size(), level.tilesets_.size());
+        return true;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc < 2)
+    {
+        spdlog::error("Usage: mw-mapc <map.tmj> [map2.tmj ...]");
+        return 1;
+    }
+
+    int failed = 0;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (!compileMap(argv[i]))
+        {
+            ++failed;
+        }
+    }
+    return failed == 0 ? 0 : 1;
+}